@@ -275,7 +275,12 @@ cod_close_file(void)
   _write_source_file_block();
   gp_cod_write_code(state.device.class, state.i_memory, main_dir);
   gp_cod_enumerate_directory(main_dir);
-  gp_cod_write_directory(state.cod.f, main_dir);
+
+  if (!gp_cod_write_directory(state.cod.f, main_dir)) {
+    fprintf(stderr, "%s() -- Could not write cod file.\n", __func__);
+    exit(1);
+  }
+
   gp_cod_free_directory(main_dir);
   fclose(state.cod.f);
 
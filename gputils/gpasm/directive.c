@@ -36,6 +36,8 @@ Boston, MA 02111-1307, USA.  */
 #include "gpmsg.h"
 #include "special.h"
 #include "gpcfg.h"
+#include "hcache.h"
+#include "replay.h"
 
 /* Forward declarations */
 
@@ -243,7 +245,7 @@ _hv_macro_resolver(const char* String)
         memcpy(buf, hv_start, raw_size);
         buf[raw_size] = '\0';
         /* It executes the macro and get the result. */
-        preprocess_line(buf, &raw_size, sizeof(buf));
+        preprocess_line(buf, &raw_size, sizeof(buf), false);
 
         if (raw_size > (int)(sizeof(out) - out_idx - 1)) {
           gpmsg_verror(GPE_TOO_LONG, NULL, buf, (size_t)raw_size, sizeof(out) - out_idx - 1);
@@ -2552,6 +2554,9 @@ _do_define(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
           assert(PnIsList(p));
           gp_sym_annotate_symbol(curr_def, p);
         }
+
+        preprocess_add_define(gp_sym_get_symbol_name(curr_def));
+        replay_define(gp_sym_get_symbol_name(curr_def), p);
       }
     }
   }
@@ -3754,6 +3759,7 @@ static gpasmVal
 _do_ifdef(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
 {
   const pnode_t *p;
+  gp_boolean     is_defined;
 
   if (_check_processor_select(Name)) {
     return Value;
@@ -3772,10 +3778,15 @@ _do_ifdef(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
       if (!(PnIsSymbol(p))) {
         gpmsg_error(GPE_ILLEGAL_LABEL, "Illegal label.");
       }
-      else if ((gp_sym_get_symbol(state.stDefines, PnSymbol(p)) != NULL) ||
-               (gp_sym_get_symbol(state.stTop, PnSymbol(p)) != NULL)) {
-        state.astack->enabled             = true;
-        state.astack->before_else_enabled = state.astack->enabled;
+      else {
+        is_defined = ((gp_sym_get_symbol(state.stDefines, PnSymbol(p)) != NULL) ||
+                      (gp_sym_get_symbol(state.stTop, PnSymbol(p)) != NULL));
+        hcache_record_cond(PnSymbol(p), is_defined);
+
+        if (is_defined) {
+          state.astack->enabled             = true;
+          state.astack->before_else_enabled = state.astack->enabled;
+        }
       }
     }
   }
@@ -3834,6 +3845,7 @@ static gpasmVal
 _do_ifndef(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
 {
   const pnode_t *p;
+  gp_boolean     is_defined;
 
   if (_check_processor_select(Name)) {
     return Value;
@@ -3852,10 +3864,15 @@ _do_ifndef(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
       if (!(PnIsSymbol(p))) {
         gpmsg_error(GPE_ILLEGAL_LABEL, "Illegal label.");
       }
-      else if ((gp_sym_get_symbol(state.stDefines, PnSymbol(p)) == NULL) &&
-               (gp_sym_get_symbol(state.stTop, PnSymbol(p)) == NULL)) {
-        state.astack->enabled             = true;
-        state.astack->before_else_enabled = state.astack->enabled;
+      else {
+        is_defined = ((gp_sym_get_symbol(state.stDefines, PnSymbol(p)) != NULL) ||
+                      (gp_sym_get_symbol(state.stTop, PnSymbol(p)) != NULL));
+        hcache_record_cond(PnSymbol(p), is_defined);
+
+        if (!is_defined) {
+          state.astack->enabled             = true;
+          state.astack->before_else_enabled = state.astack->enabled;
+        }
       }
     }
   }
@@ -4270,9 +4287,10 @@ _do_macro(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
 
   head = GP_Malloc(sizeof(*head));
 
-  head->parms   = Parms;
-  head->body    = NULL;
-  head->defined = false;
+  head->parms    = Parms;
+  head->body     = NULL;
+  head->defined  = false;
+  head->compiled = false;
   /* Record data for the list, cod, and coff files. */
   head->line_number = state.src_list.last->line_number;
   head->file_symbol = state.src_list.last->file_symbol;
@@ -4986,7 +5004,11 @@ _do_undefine(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
     if (PnIsSymbol(p)) {
       sname = PnSymbol(p);
 
-      if (!gp_sym_remove_symbol(state.stDefines, sname)) {
+      if (gp_sym_remove_symbol(state.stDefines, sname)) {
+        preprocess_remove_define(sname);
+        replay_undefine(sname);
+      }
+      else {
         if ((!state.mpasm_compatible) && (state.strict_level == 2)) {
           gpmsg_verror(GPE_SYM_NOT_DEFINED, NULL, sname);
         }
@@ -5069,8 +5091,9 @@ _do_while(gpasmVal Value, const char *Name, int Arity, pnode_t *Parms)
 
   head = GP_Malloc(sizeof(*head));
   state.lst.line.linetype = LTY_DOLIST_DIR;
-  head->parms = (eval_enforce_arity(Arity, 1)) ? PnListHead(Parms) : NULL;
-  head->body  = NULL;
+  head->parms    = (eval_enforce_arity(Arity, 1)) ? PnListHead(Parms) : NULL;
+  head->body     = NULL;
+  head->compiled = false;
 
   /* Record data for the list, cod, and coff files. */
   head->line_number = state.src_list.last->line_number;
@@ -5898,6 +5921,7 @@ do_insn(const char *Op_name, pnode_t *Parameters)
 
     /* Interpret the instruction if assembly is enabled, or if it's a conditional. */
     if (asm_enabled() || FlagIsSet(ins->attribs, ATTRIB_COND)) {
+      hcache_record_insn(sym_name, Parameters);
       state.lst.line.linetype = LTY_INSN;
       icode = ins->icode;
 
@@ -8043,6 +8067,11 @@ do_insn(const char *Op_name, pnode_t *Parameters)
     } /* if (asm_enabled() || (ins->attribs & ATTRIB_COND)) */
   } /* if (sym != NULL) */
   else {
+    if (asm_enabled()) {
+      /* A macro call or an unknown opcode. */
+      hcache_abort();
+    }
+
     sym = gp_sym_get_symbol(state.stMacros, Op_name);
 
     if (sym != NULL) {
@@ -8334,6 +8363,9 @@ opcode_init(int Stage)
 void
 begin_cblock(const pnode_t *Cblock)
 {
+  /* The cblock counter outlives the file. */
+  hcache_abort();
+
   if (asm_enabled()) {
     state.cblock_defined = true;
     state.cblock = eval_maybe_evaluate(Cblock);
@@ -8345,6 +8377,8 @@ begin_cblock(const pnode_t *Cblock)
 void
 continue_cblock(void)
 {
+  hcache_abort();
+
   if (!state.cblock_defined) {
     gpmsg_vmessage(GPM_CBLOCK, NULL);
   }
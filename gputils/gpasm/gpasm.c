@@ -38,6 +38,9 @@ Boston, MA 02111-1307, USA.  */
 #include "processor.h"
 #include "coff.h"
 #include "gpcfg.h"
+#include "hcache.h"
+#include "preprocess.h"
+#include "replay.h"
 
 extern int yyparse(void);
 extern int yydebug;
@@ -58,7 +61,9 @@ typedef struct {
 
 enum {
   OPT_MPASM_COMPATIBLE = 0x100,
-  OPT_STRICT_OPTIONS
+  OPT_STRICT_OPTIONS,
+  OPT_HEADER_CACHE,
+  OPT_REPLAY_SOURCE
 #ifdef GPUTILS_DEBUG
   , OPT_DUMP_COFF
 #endif
@@ -76,6 +81,7 @@ static struct option longopts[] =
   { "full-address",              no_argument,       NULL, 'f' },
   { "debug-info",                no_argument,       NULL, 'g' },
   { "help",                      no_argument,       NULL, 'h' },
+  { "header-cache",              required_argument, NULL, OPT_HEADER_CACHE },
   { "ignore-case",               no_argument,       NULL, 'i' },
   { "sdcc-dev16-list",           no_argument,       NULL, 'j' },
   { "error",                     no_argument,       NULL, 'k' },
@@ -88,6 +94,7 @@ static struct option longopts[] =
   { "processor",                 required_argument, NULL, 'p' },
   { "quiet",                     no_argument,       NULL, 'q' },
   { "radix",                     required_argument, NULL, 'r' },
+  { "replay-source",             no_argument,       NULL, OPT_REPLAY_SOURCE },
   { "list-processor-properties", optional_argument, NULL, 's' },
   { "strict",                    required_argument, NULL, 'S' },
   { "strict-options",            no_argument,       NULL, OPT_STRICT_OPTIONS },
@@ -126,6 +133,8 @@ _show_usage(void)
   printf("  -f, --full-address             Show full address in .lst file at the memory map region.\n");
   printf("  -g, --debug-info               Use debug directives for COFF.\n");
   printf("  -h, --help                     Show this usage message.\n");
+  printf("      --header-cache DIR         Keep the processed include files in the DIR directory\n"
+         "                                 and reuse them at the next includes.\n");
   printf("  -i, --ignore-case              Case insensitive.\n");
   printf("  -I DIR, --include DIR          Specify include directory.\n");
   printf("  -j, --sdcc-dev16-list          Help to the extension of the pic16devices.txt file\n"
@@ -154,6 +163,8 @@ _show_usage(void)
   printf("  -P FILE, --preprocess FILE     Write preprocessed asm file to FILE.\n");
   printf("  -q, --quiet                    Suppress anything sent to standard output.\n");
   printf("  -r RADIX, --radix RADIX        Select radix. [hex]\n");
+  printf("      --replay-source            Reuse the source lines which the first pass has read and\n"
+         "                                 preprocessed in the second pass.\n");
   printf("  -s[12[ce]|14[cef]|16[ce]], --list-processor-properties[=([12[ce]|14[cef]|16[ce]])]\n"
          "                                 Lists properties of the processors. Using by itself,\n"
          "                                 displays the all devices or group of the devices. Along\n"
@@ -867,6 +878,14 @@ process_args(int argc, char *argv[])
         state.mpasm_compatible = true;
         break;
 
+      case OPT_HEADER_CACHE:
+        hcache_enable(optarg);
+        break;
+
+      case OPT_REPLAY_SOURCE:
+        replay_enable();
+        break;
+
 #ifdef GPUTILS_DEBUG
       case OPT_DUMP_COFF:
         gp_dump_coff = true;
@@ -953,6 +972,7 @@ assemble(void)
 
   /* Store the command line defines to restore on second pass. */
   cmd_defines    = state.stDefines;
+  hcache_init(cmd_defines);
   state.c_memory = gp_mem_i_create();
   state.i_memory = state.c_memory;
 
@@ -984,6 +1004,8 @@ assemble(void)
   _set_global_constants();
 
   state.pass = 1;
+  preprocess_init_defines(cmd_defines);
+  replay_begin_pass();
   open_src(state.src_file_name, false);
   yyparse();
   yylex_destroy();
@@ -1032,9 +1054,12 @@ assemble(void)
 
   _set_global_constants();
 
+  preprocess_init_defines(cmd_defines);
+  replay_begin_pass();
   open_src(state.src_file_name, false);
   yydebug = (!gp_debug_disable) ? true : false;
   yyparse();
+  replay_free();
 
   assert(state.pass == 2);
 
@@ -0,0 +1,1036 @@
+/* Cache of the processed header files
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#include "stdhdr.h"
+
+#include "libgputils.h"
+#include "gpasm.h"
+#include "directive.h"
+#include "lst.h"
+#include "hcache.h"
+
+/* An included file is assembled normally the first time, on the second pass its effects are
+   recorded: the directives with constant parameters, the defined constants, the tested symbols
+   and the listed lines. The record is written in the cache directory, and the next includes of
+   the file execute it again instead of reading, preprocessing and parsing the source.
+
+   A file is recorded only if it has no other effects: no code, no variable, no message, no
+   nested file or macro. Any other statement stops the recording. */
+
+#define HCACHE_MAGIC                    "GPHC"
+#define HCACHE_VERSION                  1
+#define HCACHE_HEAD_SIZE                56
+
+enum hcache_event {
+  HC_LINE = 1,                          /* line number, line type, value, source line */
+  HC_INSN,                              /* line number, name, defined name, parameters */
+  HC_SYMBOL,                            /* line number, name, value */
+  HC_COND                               /* name, defined */
+};
+
+#define HC_PNODE_NULL                   0xff
+
+typedef struct hcache_buffer {
+  uint8_t *data;
+  size_t   length;
+  size_t   size;
+} hcache_buffer_t;
+
+typedef struct hcache_reader {
+  const uint8_t *pos;
+  const uint8_t *end;
+  gp_boolean     error;
+} hcache_reader_t;
+
+/* The cache files which were read, the second pass uses them again. */
+typedef struct hcache_entry {
+  struct hcache_entry *next;
+  char                *file_name;
+  uint8_t             *data;
+  hash128_t            key;
+  uint32_t             src_size;
+  uint64_t             src_mtime;
+  hash128_t            src_hash;
+  const uint8_t       *events;
+  size_t               events_length;
+} hcache_entry_t;
+
+static const char     *cache_dir = NULL;
+static hash128_t       defines_hash;
+static hcache_entry_t *entries = NULL;
+
+static struct {
+  const source_context_t *ctx;          /* The recorded file, NULL if there is no recording. */
+  char                    file_name[BUFSIZ];
+  hash128_t               key;
+  uint32_t                src_size;
+  uint64_t                src_mtime;
+  hash128_t               src_hash;
+  hcache_buffer_t         events;
+  unsigned int            byte_addr;
+  const amode_t          *astack;
+  uint8_t                 num[sizeof(state.num)];
+} rec;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_put_mem(hcache_buffer_t *Buffer, const void *Data, size_t Length)
+{
+  if ((Buffer->length + Length) > Buffer->size) {
+    Buffer->size = (Buffer->size == 0) ? 4096 : Buffer->size;
+
+    while ((Buffer->length + Length) > Buffer->size) {
+      Buffer->size *= 2;
+    }
+
+    Buffer->data = (uint8_t *)GP_Realloc(Buffer->data, Buffer->size);
+  }
+
+  memcpy(&Buffer->data[Buffer->length], Data, Length);
+  Buffer->length += Length;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_put_u8(hcache_buffer_t *Buffer, unsigned int Data)
+{
+  uint8_t byte;
+
+  byte = (uint8_t)Data;
+  _put_mem(Buffer, &byte, 1);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_put_u32(hcache_buffer_t *Buffer, uint32_t Data)
+{
+  uint8_t bytes[4];
+
+  gp_putl32(bytes, Data);
+  _put_mem(Buffer, bytes, sizeof(bytes));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The strings are stored with their terminating zero. */
+
+static void
+_put_str(hcache_buffer_t *Buffer, const char *String)
+{
+  size_t length;
+
+  length = strlen(String) + 1;
+  _put_u32(Buffer, (uint32_t)length);
+  _put_mem(Buffer, String, length);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_put_hash(hcache_buffer_t *Buffer, const hash128_t *Hash)
+{
+  _put_u32(Buffer, Hash->low.u32[0]);
+  _put_u32(Buffer, Hash->low.u32[1]);
+  _put_u32(Buffer, Hash->high.u32[0]);
+  _put_u32(Buffer, Hash->high.u32[1]);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Only the constant parameters can be stored, the symbols are the parameter names of a #define. */
+
+static gp_boolean
+_put_pnode(hcache_buffer_t *Buffer, const pnode_t *Pnode, gp_boolean Symbol_enabled)
+{
+  if (Pnode == NULL) {
+    _put_u8(Buffer, HC_PNODE_NULL);
+    return true;
+  }
+
+  _put_u8(Buffer, Pnode->tag);
+
+  switch (Pnode->tag) {
+    case PTAG_CONSTANT:
+      _put_u32(Buffer, (uint32_t)PnConstant(Pnode));
+      return true;
+
+    case PTAG_SYMBOL:
+      if (!Symbol_enabled) {
+        return false;
+      }
+
+      _put_str(Buffer, PnSymbol(Pnode));
+      return true;
+
+    case PTAG_STRING:
+      _put_str(Buffer, PnString(Pnode));
+      return true;
+
+    case PTAG_LIST:
+      return (_put_pnode(Buffer, PnListHead(Pnode), Symbol_enabled) &&
+              _put_pnode(Buffer, PnListTail(Pnode), Symbol_enabled));
+
+    case PTAG_BINOP:
+      _put_u32(Buffer, (uint32_t)PnBinOpOp(Pnode));
+      return (_put_pnode(Buffer, PnBinOpP0(Pnode), Symbol_enabled) &&
+              _put_pnode(Buffer, PnBinOpP1(Pnode), Symbol_enabled));
+
+    case PTAG_UNOP:
+      _put_u32(Buffer, (uint32_t)PnUnOpOp(Pnode));
+      return _put_pnode(Buffer, PnUnOpP0(Pnode), Symbol_enabled);
+
+    default:
+      return false;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static unsigned int
+_get_u8(hcache_reader_t *Reader)
+{
+  if (Reader->pos >= Reader->end) {
+    Reader->error = true;
+    return 0;
+  }
+
+  return *(Reader->pos)++;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static uint32_t
+_get_u32(hcache_reader_t *Reader)
+{
+  uint32_t data;
+
+  if ((Reader->end - Reader->pos) < 4) {
+    Reader->error = true;
+    return 0;
+  }
+
+  data = gp_getu32(Reader->pos);
+  Reader->pos += 4;
+  return data;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static const char *
+_get_str(hcache_reader_t *Reader)
+{
+  const char *string;
+  uint32_t    length;
+
+  length = _get_u32(Reader);
+
+  if (Reader->error || (length == 0) || ((uint32_t)(Reader->end - Reader->pos) < length) ||
+      (Reader->pos[length - 1] != '\0')) {
+    Reader->error = true;
+    return "";
+  }
+
+  string = (const char *)Reader->pos;
+  Reader->pos += length;
+  return string;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_get_hash(hcache_reader_t *Reader, hash128_t *Hash)
+{
+  Hash->low.u32[0]  = _get_u32(Reader);
+  Hash->low.u32[1]  = _get_u32(Reader);
+  Hash->high.u32[0] = _get_u32(Reader);
+  Hash->high.u32[1] = _get_u32(Reader);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Reads a parameter tree. If Build is false it is only skipped. */
+
+static pnode_t *
+_get_pnode(hcache_reader_t *Reader, gp_boolean Build)
+{
+  unsigned int  tag;
+  int           op;
+  int           value;
+  const char   *string;
+  pnode_t      *p0;
+  pnode_t      *p1;
+
+  tag = _get_u8(Reader);
+
+  if (Reader->error || (tag == HC_PNODE_NULL)) {
+    return NULL;
+  }
+
+  switch (tag) {
+    case PTAG_CONSTANT:
+      value = (int)_get_u32(Reader);
+      return (Build) ? mk_constant(value) : NULL;
+
+    case PTAG_SYMBOL:
+      string = _get_str(Reader);
+      return (Build) ? mk_symbol(GP_Strdup(string)) : NULL;
+
+    case PTAG_STRING:
+      string = _get_str(Reader);
+      return (Build) ? mk_string(GP_Strdup(string)) : NULL;
+
+    case PTAG_LIST:
+      p0 = _get_pnode(Reader, Build);
+      p1 = _get_pnode(Reader, Build);
+      return (Build) ? mk_list(p0, p1) : NULL;
+
+    case PTAG_BINOP:
+      op = (int)_get_u32(Reader);
+      p0 = _get_pnode(Reader, Build);
+      p1 = _get_pnode(Reader, Build);
+      return (Build) ? mk_2op(op, p0, p1) : NULL;
+
+    case PTAG_UNOP:
+      op = (int)_get_u32(Reader);
+      p0 = _get_pnode(Reader, Build);
+      return (Build) ? mk_1op(op, p0) : NULL;
+
+    default:
+      Reader->error = true;
+      return NULL;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The options which change the meaning of a header file. */
+
+static void
+_make_key(hash128_t *Key)
+{
+  int values[7];
+
+  values[0] = HCACHE_VERSION;
+  values[1] = state.radix;
+  values[2] = state.case_insensitive;
+  values[3] = state.mpasm_compatible;
+  values[4] = state.extended_pic16e;
+  values[5] = state.strict_level;
+  values[6] = state.mode;
+
+  gp_hash_init(Key);
+  gp_hash_str(Key, VERSION, false);
+  gp_hash_mem(Key, values, sizeof(values));
+  gp_hash_str(Key, (state.processor != NULL) ? state.processor->defined_as : "", false);
+  gp_hash_mem(Key, &defines_hash, sizeof(defines_hash));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_make_file_name(char *Buffer, size_t Sizeof_buffer, const hash128_t *Key, const char *Src_name)
+{
+  hash128_t hash;
+
+  hash = *Key;
+  gp_hash_str(&hash, Src_name, false);
+  snprintf(Buffer, Sizeof_buffer, "%s%c%08X%08X%08X%08X.ghc", cache_dir, PATH_SEPARATOR_CHAR,
+           hash.high.u32[1], hash.high.u32[0], hash.low.u32[1], hash.low.u32[0]);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Reads a whole file into the memory. */
+
+static uint8_t *
+_read_file(const char *File_name, size_t *Length)
+{
+  FILE        *f;
+  struct stat  st;
+  uint8_t     *data;
+
+  if ((stat(File_name, &st) != 0) || (st.st_size < 0)) {
+    return NULL;
+  }
+
+  f = fopen(File_name, "rb");
+
+  if (f == NULL) {
+    return NULL;
+  }
+
+  *Length = (size_t)st.st_size;
+  data    = (uint8_t *)GP_Malloc((*Length > 0) ? *Length : 1);
+
+  if (fread(data, 1, *Length, f) != *Length) {
+    free(data);
+    data = NULL;
+  }
+
+  fclose(f);
+  return data;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static gp_boolean
+_stat_source(const char *Src_name, uint32_t *Size, uint64_t *Mtime)
+{
+  struct stat st;
+
+  if (stat(Src_name, &st) != 0) {
+    return false;
+  }
+
+  *Size  = (uint32_t)st.st_size;
+  *Mtime = (uint64_t)st.st_mtime;
+  return true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static gp_boolean
+_hash_source(const char *Src_name, hash128_t *Hash)
+{
+  uint8_t *data;
+  size_t   length;
+
+  data = _read_file(Src_name, &length);
+
+  if (data == NULL) {
+    return false;
+  }
+
+  gp_hash_init(Hash);
+  gp_hash_mem(Hash, data, length);
+  free(data);
+  return true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Reads a cache file and checks its format, or finds it among the files already read. */
+
+static const hcache_entry_t *
+_load(const char *File_name)
+{
+  hcache_entry_t  *entry;
+  hcache_reader_t  reader;
+  uint8_t         *data;
+  size_t           length;
+  uint32_t         mtime_low;
+  hash128_t        events_hash;
+  hash128_t        hash;
+
+  for (entry = entries; entry != NULL; entry = entry->next) {
+    if (strcmp(entry->file_name, File_name) == 0) {
+      return entry;
+    }
+  }
+
+  data = _read_file(File_name, &length);
+
+  if (data == NULL) {
+    return NULL;
+  }
+
+  if ((length < (HCACHE_HEAD_SIZE + 16)) || (memcmp(data, HCACHE_MAGIC, 4) != 0)) {
+    free(data);
+    return NULL;
+  }
+
+  entry = GP_Calloc(1, sizeof(hcache_entry_t));
+  reader.pos   = &data[4];
+  reader.end   = &data[length];
+  reader.error = (_get_u32(&reader) != HCACHE_VERSION);
+
+  _get_hash(&reader, &entry->key);
+  entry->src_size      = _get_u32(&reader);
+  mtime_low            = _get_u32(&reader);
+  entry->src_mtime     = ((uint64_t)_get_u32(&reader) << 32) | mtime_low;
+  _get_hash(&reader, &entry->src_hash);
+  entry->events_length = _get_u32(&reader);
+  entry->events        = reader.pos;
+
+  if ((!reader.error) && (entry->events_length == (length - HCACHE_HEAD_SIZE - 16))) {
+    reader.pos += entry->events_length;
+    _get_hash(&reader, &events_hash);
+    gp_hash_init(&hash);
+    gp_hash_mem(&hash, entry->events, entry->events_length);
+  }
+  else {
+    reader.error = true;
+  }
+
+  if (reader.error || (memcmp(&hash, &events_hash, sizeof(hash)) != 0)) {
+    free(entry);
+    free(data);
+    return NULL;
+  }
+
+  entry->file_name = GP_Strdup(File_name);
+  entry->data      = data;
+  entry->next      = entries;
+  entries          = entry;
+  return entry;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* A new cache file was written, the old one must be read again. */
+
+static void
+_forget(const char *File_name)
+{
+  hcache_entry_t **link;
+  hcache_entry_t  *entry;
+
+  for (link = &entries; *link != NULL; link = &(*link)->next) {
+    entry = *link;
+
+    if (strcmp(entry->file_name, File_name) == 0) {
+      *link = entry->next;
+      free(entry->file_name);
+      free(entry->data);
+      free(entry);
+      return;
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The record belongs to these options and to this version of the source file. */
+
+static gp_boolean
+_is_current(const hcache_entry_t *Entry, const hash128_t *Key, const char *Src_name)
+{
+  uint32_t  size;
+  uint64_t  mtime;
+  hash128_t hash;
+
+  if (memcmp(&Entry->key, Key, sizeof(hash128_t)) != 0) {
+    return false;
+  }
+
+  if (!_stat_source(Src_name, &size, &mtime)) {
+    return false;
+  }
+
+  if ((size == Entry->src_size) && (mtime == Entry->src_mtime)) {
+    return true;
+  }
+
+  /* The time stamp was changed, but maybe not the content. */
+  return (_hash_source(Src_name, &hash) && (memcmp(&hash, &Entry->src_hash, sizeof(hash)) == 0));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The state before the file, on which the record does not depend. */
+
+static gp_boolean
+_is_cacheable(void)
+{
+  const source_context_t *ctx;
+
+  if ((cache_dir == NULL) || (state.preproc.f != NULL) || (IN_MACRO_WHILE_DEFINITION) ||
+      (state.stTop != state.stGlobal) || (gp_sym_get_symbol_count(state.stDefines) > 0)) {
+    /* The defines of the source could change the lines of the file. */
+    return false;
+  }
+
+  for (ctx = state.src_list.last; ctx != NULL; ctx = ctx->prev) {
+    if (ctx->type != SRC_FILE) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Checks that the tests of the file give the same results as at the recording. The symbols which
+   were defined by the file itself are collected in a temporary arena table, which the pop
+   releases as a whole. */
+
+static gp_boolean
+_check_conditions(const hcache_entry_t *Entry)
+{
+  hcache_reader_t  reader;
+  symbol_table_t  *defined;
+  const char      *name;
+  gp_boolean       is_defined;
+  gp_boolean       match;
+
+  defined      = gp_sym_push_arena_table(NULL, state.case_insensitive);
+  reader.pos   = Entry->events;
+  reader.end   = &Entry->events[Entry->events_length];
+  reader.error = false;
+  match        = true;
+
+  while (match && (!reader.error) && (reader.pos < reader.end)) {
+    switch (_get_u8(&reader)) {
+      case HC_LINE:
+        _get_u32(&reader);
+        _get_u32(&reader);
+        _get_u32(&reader);
+        _get_str(&reader);
+        break;
+
+      case HC_INSN:
+        _get_u32(&reader);
+        _get_str(&reader);
+        name = _get_str(&reader);
+
+        if (*name != '\0') {
+          gp_sym_add_symbol(defined, name);
+        }
+
+        _get_pnode(&reader, false);
+        break;
+
+      case HC_SYMBOL:
+        _get_u32(&reader);
+        gp_sym_add_symbol(defined, _get_str(&reader));
+        _get_u32(&reader);
+        break;
+
+      case HC_COND:
+        name       = _get_str(&reader);
+        is_defined = ((gp_sym_get_symbol(state.stDefines, name) != NULL) ||
+                      (gp_sym_get_symbol(state.stTop, name) != NULL) ||
+                      (gp_sym_get_symbol(defined, name) != NULL));
+        match      = (is_defined == (_get_u8(&reader) != 0));
+        break;
+
+      default:
+        reader.error = true;
+        break;
+    }
+  }
+
+  gp_sym_pop_table(defined);
+  return (match && (!reader.error));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Executes the record of a file instead of its source. */
+
+static void
+_replay(const hcache_entry_t *Entry, source_context_t *Ctx)
+{
+  hcache_reader_t  reader;
+  unsigned int     line_number;
+  unsigned int     linetype;
+  gpasmVal         value;
+  const char      *name;
+  pnode_t         *parms;
+
+  reader.pos   = Entry->events;
+  reader.end   = &Entry->events[Entry->events_length];
+  reader.error = false;
+
+  while ((!reader.error) && (reader.pos < reader.end)) {
+    switch (_get_u8(&reader)) {
+      case HC_LINE:
+        line_number = _get_u32(&reader);
+        linetype    = _get_u32(&reader);
+        value       = (gpasmVal)_get_u32(&reader);
+        name        = _get_str(&reader);
+
+        if (state.pass == 2) {
+          Ctx->line_number        = line_number;
+          state.lst.line.linetype = linetype;
+          lst_format_line(name, value);
+        }
+        break;
+
+      case HC_INSN:
+        Ctx->line_number = _get_u32(&reader);
+        name             = _get_str(&reader);
+        _get_str(&reader);
+        parms            = _get_pnode(&reader, true);
+        do_insn(name, parms);
+        break;
+
+      case HC_SYMBOL:
+        Ctx->line_number = _get_u32(&reader);
+        name             = _get_str(&reader);
+        value            = (gpasmVal)_get_u32(&reader);
+        set_global(name, value, VAL_CONSTANT, false, false);
+        break;
+
+      case HC_COND:
+        _get_str(&reader);
+        _get_u8(&reader);
+        break;
+
+      default:
+        reader.error = true;
+        break;
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_stop(void)
+{
+  if (rec.events.data != NULL) {
+    free(rec.events.data);
+  }
+
+  memset(&rec, 0, sizeof(rec));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The recording continues only in its own file. */
+
+static gp_boolean
+_is_recording(void)
+{
+  if (rec.ctx == NULL) {
+    return false;
+  }
+
+  if (state.src_list.last != rec.ctx) {
+    _stop();
+    return false;
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The file has not emitted code or messages yet. */
+
+static gp_boolean
+_has_no_effect(void)
+{
+  return ((state.byte_addr == rec.byte_addr) && (memcmp(rec.num, &state.num, sizeof(rec.num)) == 0));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_write(void)
+{
+  hcache_buffer_t  head;
+  hash128_t        events_hash;
+  char             tmp_name[BUFSIZ + 32];
+  FILE            *f;
+  gp_boolean       ok;
+
+  memset(&head, 0, sizeof(head));
+  _put_mem(&head, HCACHE_MAGIC, 4);
+  _put_u32(&head, HCACHE_VERSION);
+  _put_hash(&head, &rec.key);
+  _put_u32(&head, rec.src_size);
+  _put_u32(&head, (uint32_t)rec.src_mtime);
+  _put_u32(&head, (uint32_t)(rec.src_mtime >> 32));
+  _put_hash(&head, &rec.src_hash);
+  _put_u32(&head, (uint32_t)rec.events.length);
+  assert(head.length == HCACHE_HEAD_SIZE);
+
+  gp_hash_init(&events_hash);
+  gp_hash_mem(&events_hash, rec.events.data, rec.events.length);
+  _put_hash(&rec.events, &events_hash);
+
+  /* Another assembler may read the cache at the same time, so the file is written under a
+     temporary name and then renamed. */
+#ifdef HAVE_UNISTD_H
+  snprintf(tmp_name, sizeof(tmp_name), "%s.%ld.tmp", rec.file_name, (long)getpid());
+#else
+  snprintf(tmp_name, sizeof(tmp_name), "%s.tmp", rec.file_name);
+#endif
+
+  f = fopen(tmp_name, "wb");
+
+  if (f == NULL) {
+    gp_debug("Can not write the header cache \"%s\".", tmp_name);
+    free(head.data);
+    return;
+  }
+
+  ok = ((fwrite(head.data, 1, head.length, f) == head.length) &&
+        (fwrite(rec.events.data, 1, rec.events.length, f) == rec.events.length));
+  ok = ((fclose(f) == 0) && ok);
+  free(head.data);
+
+  if (ok && (rename(tmp_name, rec.file_name) != 0)) {
+    /* On some systems the rename does not replace an existing file. */
+    remove(rec.file_name);
+    ok = (rename(tmp_name, rec.file_name) == 0);
+  }
+
+  if (!ok) {
+    remove(tmp_name);
+    return;
+  }
+
+  _forget(rec.file_name);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Enables the cache, the files are kept in the Dir directory. */
+
+void
+hcache_enable(const char *Dir)
+{
+  cache_dir = Dir;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The defines of the command line belong to the key of the records. */
+
+void
+hcache_init(const symbol_table_t *Cmd_defines)
+{
+  const symbol_t **array;
+  const pnode_t   *value;
+  size_t           num;
+  size_t           i;
+
+  gp_hash_init(&defines_hash);
+
+  if (cache_dir == NULL) {
+    return;
+  }
+
+  num   = gp_sym_get_symbol_count(Cmd_defines);
+  array = gp_sym_clone_symbol_array(Cmd_defines, gp_sym_compare_fn);
+
+  for (i = 0; i < num; ++i) {
+    gp_hash_str(&defines_hash, gp_sym_get_symbol_name(array[i]), false);
+    value = (const pnode_t *)gp_sym_get_symbol_annotation(array[i]);
+    gp_hash_str(&defines_hash, "=", false);
+
+    if ((value != NULL) && PnIsList(value) && (PnListHead(value) != NULL) && PnIsString(PnListHead(value))) {
+      gp_hash_str(&defines_hash, PnString(PnListHead(value)), false);
+    }
+
+    gp_hash_str(&defines_hash, ";", false);
+  }
+
+  if (array != NULL) {
+    free(array);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Called when an included file is opened. If the file has a current record, it is executed and
+   the result is true: the file need not be read. Otherwise the second pass begins to record it. */
+
+gp_boolean
+hcache_open(source_context_t *Ctx)
+{
+  const hcache_entry_t *entry;
+  hash128_t             key;
+  char                  file_name[BUFSIZ];
+
+  if (!_is_cacheable()) {
+    return false;
+  }
+
+  _make_key(&key);
+  _make_file_name(file_name, sizeof(file_name), &key, Ctx->name);
+  entry = _load(file_name);
+
+  if ((entry != NULL) && _is_current(entry, &key, Ctx->name)) {
+    if (!_check_conditions(entry)) {
+      /* The record is good, only not in this place. */
+      return false;
+    }
+
+    _replay(entry, Ctx);
+    return true;
+  }
+
+  if ((state.pass != 2) || (rec.ctx != NULL)) {
+    return false;
+  }
+
+  if (!_stat_source(Ctx->name, &rec.src_size, &rec.src_mtime) || !_hash_source(Ctx->name, &rec.src_hash)) {
+    return false;
+  }
+
+  gp_strncpy(rec.file_name, file_name, sizeof(rec.file_name));
+  rec.key       = key;
+  rec.ctx       = Ctx;
+  rec.byte_addr = state.byte_addr;
+  rec.astack    = state.astack;
+  memcpy(rec.num, &state.num, sizeof(rec.num));
+  return false;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Called when a file is closed. The end of a recorded file writes its record. */
+
+void
+hcache_close(const source_context_t *Ctx)
+{
+  if (rec.ctx == NULL) {
+    return;
+  }
+
+  if ((Ctx == rec.ctx) && _has_no_effect() && (state.astack == rec.astack)) {
+    _write();
+  }
+
+  _stop();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The current statement can not be recorded. */
+
+void
+hcache_abort(void)
+{
+  if (rec.ctx != NULL) {
+    _stop();
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Records an executed directive. The conditional directives are not recorded, only the tests and
+   the lines which they enable. */
+
+void
+hcache_record_insn(const char *Name, const pnode_t *Parms)
+{
+  static const char * const conds[] = {
+    "ifdef", "#ifdef", "ifndef", "#ifndef", "else", "#else", "endif", "#endif"
+  };
+
+  static const char * const insns[] = {
+    "equ", "#define", "list", "nolist", "__maxram", "__badram"
+  };
+
+  const char *defined;
+  size_t      i;
+
+  if (!_is_recording()) {
+    return;
+  }
+
+  for (i = 0; i < ARRAY_SIZE(conds); ++i) {
+    if (strcasecmp(Name, conds[i]) == 0) {
+      return;
+    }
+  }
+
+  for (i = 0; i < ARRAY_SIZE(insns); ++i) {
+    if (strcasecmp(Name, insns[i]) == 0) {
+      break;
+    }
+  }
+
+  if (i >= ARRAY_SIZE(insns)) {
+    _stop();
+    return;
+  }
+
+  defined = "";
+  if ((strcasecmp(Name, "#define") == 0) && (Parms != NULL) && PnIsList(Parms) && PnIsString(PnListHead(Parms))) {
+    defined = PnString(PnListHead(Parms));
+  }
+
+  _put_u8(&rec.events, HC_INSN);
+  _put_u32(&rec.events, rec.ctx->line_number);
+  _put_str(&rec.events, Name);
+  _put_str(&rec.events, defined);
+
+  if (!_put_pnode(&rec.events, Parms, (*defined != '\0'))) {
+    _stop();
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+hcache_record_cond(const char *Name, gp_boolean Defined)
+{
+  if (!_is_recording()) {
+    return;
+  }
+
+  _put_u8(&rec.events, HC_COND);
+  _put_str(&rec.events, Name);
+  _put_u8(&rec.events, Defined);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Only the constants can be recorded, the other symbols depend on the code. */
+
+void
+hcache_record_symbol(const char *Name, gpasmVal Value, enum gpasmValTypes Type, gp_boolean Proc_dependent,
+                     gp_boolean Has_no_value)
+{
+  if (!_is_recording()) {
+    return;
+  }
+
+  if ((Type != VAL_CONSTANT) || Proc_dependent || Has_no_value) {
+    _stop();
+    return;
+  }
+
+  _put_u8(&rec.events, HC_SYMBOL);
+  _put_u32(&rec.events, rec.ctx->line_number);
+  _put_str(&rec.events, Name);
+  _put_u32(&rec.events, (uint32_t)Value);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+hcache_record_line(const char *Src_line, gpasmVal Value)
+{
+  if (!_is_recording()) {
+    return;
+  }
+
+  if (!_has_no_effect()) {
+    _stop();
+    return;
+  }
+
+  _put_u8(&rec.events, HC_LINE);
+  _put_u32(&rec.events, rec.ctx->line_number);
+  _put_u32(&rec.events, state.lst.line.linetype);
+  _put_u32(&rec.events, (uint32_t)Value);
+  _put_str(&rec.events, Src_line);
+}
@@ -0,0 +1,37 @@
+/* Cache of the processed header files
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#ifndef __HCACHE_H__
+#define __HCACHE_H__
+
+extern void hcache_enable(const char *Dir);
+extern void hcache_init(const symbol_table_t *Cmd_defines);
+
+extern gp_boolean hcache_open(source_context_t *Ctx);
+extern void hcache_close(const source_context_t *Ctx);
+extern void hcache_abort(void);
+
+extern void hcache_record_insn(const char *Name, const pnode_t *Parms);
+extern void hcache_record_cond(const char *Name, gp_boolean Defined);
+extern void hcache_record_symbol(const char *Name, gpasmVal Value, enum gpasmValTypes Type,
+                                 gp_boolean Proc_dependent, gp_boolean Has_no_value);
+extern void hcache_record_line(const char *Src_line, gpasmVal Value);
+
+#endif
@@ -30,6 +30,7 @@ Boston, MA 02111-1307, USA.  */
 #include "cod.h"
 #include "coff.h"
 #include "lst.h"
+#include "hcache.h"
 
 #if !HAVE_DECL_STRVERSCMP
 #include "libiberty.h"
@@ -970,6 +971,8 @@ lst_format_line(const char *Src_line, unsigned int Value)
 
   assert(Src_line != NULL);
 
+  hcache_record_line(Src_line, Value);
+
   emitted       = 0;
   emitted_lines = 0;
   bytes_emitted = 0;
@@ -82,7 +82,7 @@ void macro_setup(macro_head_t *Head, int Arity, const pnode_t *Parms)
 
   if (eval_enforce_arity(Arity, eval_list_length(Head->parms))) {
     /* push table for the marco parms */
-    state.stMacroParams = gp_sym_push_table(state.stMacroParams, state.case_insensitive);
+    state.stMacroParams = gp_sym_push_arena_table(state.stMacroParams, state.case_insensitive);
 
     /* Now add the macro's declared parameter list to the new defines table. */
     if (Arity > 0) {
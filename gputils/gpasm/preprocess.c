@@ -28,6 +28,7 @@ Boston, MA 02111-1307, USA.  */
 #include "gptypes.h"
 #include "gpsymbol.h"
 #include "preprocess.h"
+#include "hcache.h"
 
 #define DEBUG                   0
 #define DBG_printf              (!DEBUG) ? (void)0 : (void)printf
@@ -50,6 +51,65 @@ struct arg_list_s {
   struct arg_list_s *next;
 } *arg_list = NULL, *arg_list_tail = NULL;
 
+/* Cleared if the result of the current line may be different on the next pass, or if the line has
+   a message: the messages of the first pass are not shown. */
+static gp_boolean line_is_stable;
+
+/* The slots which _add_slot() has found in a macro line. */
+static macro_slot_t *slot_list = NULL;
+static unsigned int  slot_num  = 0;
+static unsigned int  slot_max  = 0;
+
+/* A counting Bloom filter of the names in stDefines: most of the identifiers of a line are not
+   #defines and need no lookup in the symbol tables. A saturated counter is never decremented. */
+#define DEFINE_FILTER_SIZE      (1 << 14)
+
+static uint8_t define_filter[DEFINE_FILTER_SIZE];
+
+/* The lowest position of a #define in the line on the last run of the #define substitution. */
+static int define_first;
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The case is always folded, so the filter is valid for both kinds of symbol tables. */
+
+static uint32_t
+_define_hash(const char *Name, int Len)
+{
+  uint32_t h;
+  int      i;
+
+  h = 2166136261u;
+  for (i = 0; i < Len; ++i) {
+    h ^= (uint8_t)tolower((unsigned char)Name[i]);
+    h *= 16777619u;
+  }
+
+  return h;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_define_filter_add(const char *Name, int Delta)
+{
+  uint32_t h;
+  uint8_t *c1;
+  uint8_t *c2;
+
+  h  = _define_hash(Name, strlen(Name));
+  c1 = &define_filter[h & (DEFINE_FILTER_SIZE - 1)];
+  c2 = &define_filter[(h >> 16) & (DEFINE_FILTER_SIZE - 1)];
+
+  if (*c1 != UINT8_MAX) {
+    *c1 += Delta;
+  }
+
+  if (*c2 != UINT8_MAX) {
+    *c2 += Delta;
+  }
+}
+
 /*------------------------------------------------------------------------------------------------*/
 
 static const char *
@@ -59,9 +119,16 @@ _check_defines(char *Symbol, int Symlen, pnode_t **Param_list_p)
   pnode_t    *p;
   pnode_t    *p2;
   const char *subst;
+  uint32_t    h;
 
   *Param_list_p = NULL;
 
+  h = _define_hash(Symbol, Symlen);
+  if ((define_filter[h & (DEFINE_FILTER_SIZE - 1)] == 0) ||
+      (define_filter[(h >> 16) & (DEFINE_FILTER_SIZE - 1)] == 0)) {
+    return NULL;
+  }
+
   /* If not quoted, check for #define substitution. */
   sym = gp_sym_get_symbol_len(state.stDefines, Symbol, Symlen);
 
@@ -187,6 +254,7 @@ _substitute_define_param(char *Buf, int Begin, int *End, int *Num, int Max_size,
       DBG_printf("@@@substituting parameter %*.*s with %s\n", mlen, mlen, &Buf[Begin], argp->str);
 
       if ((*Num + len - mlen) >= Max_size) {
+        line_is_stable = false;
         gpmsg_verror(GPE_INTERNAL, NULL, "Flex buffer too small.");
         return false;
       }
@@ -229,6 +297,10 @@ _substitute_define(char *Buf, int Begin, int *End, int *Num, int Max_size, int L
   }
 
   if ((sub = _check_defines(&Buf[Begin], mlen, &param_list)) != NULL) {
+    if ((Level == 0) && (Begin < define_first)) {
+      define_first = Begin;
+    }
+
     n_params = eval_list_length(param_list);
 
     DBG_printf("define %*.*s has %d parameters\n", mlen, mlen, &Buf[Begin], n_params);
@@ -319,6 +391,7 @@ _substitute_define(char *Buf, int Begin, int *End, int *Num, int Max_size, int L
 
               /* substitute define parameters */
               if ((*Num + len - mlen) >= Max_size) {
+                line_is_stable = false;
                 gpmsg_verror(GPE_INTERNAL, NULL, "Flex buffer too small.");
                 return false;
               }
@@ -367,6 +440,7 @@ _substitute_define(char *Buf, int Begin, int *End, int *Num, int Max_size, int L
 
       /* substitute define */
       if ((*Num + len - mlen) >= Max_size) {
+        line_is_stable = false;
         gpmsg_verror(GPE_INTERNAL, NULL, "Flex buffer too small.");
         return false;
       }
@@ -430,6 +504,7 @@ _preprocess(char *Buf, int Begin, int *End, int *Num, int Max_size, substitute_f
   int        prev_n;
 
   if (Level >= PREPROC_MAX_DEPTH) {
+    line_is_stable = false;
     gpmsg_verror(GPE_STRCPLX, NULL);
     return false;
   }
@@ -556,6 +631,33 @@ _preprocess(char *Buf, int Begin, int *End, int *Num, int Max_size, substitute_f
 
 /*------------------------------------------------------------------------------------------------*/
 
+static gp_boolean
+_has_hv(const char *Buf, int Begin, int End)
+{
+  const char *p;
+  const char *end;
+
+  if (End <= Begin) {
+    /* A #define with arguments may have taken the rest of the region. */
+    return false;
+  }
+
+  p   = &Buf[Begin];
+  end = &Buf[End];
+
+  while ((p = memchr(p, '#', end - p)) != NULL) {
+    ++p;
+
+    if (((end - p) >= 2) && ((p[0] == 'v') || (p[0] == 'V')) && (p[1] == '(')) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 static gp_boolean
 _preprocess_hv(char *Buf, int Begin, int *End, int *Num, int Max_size)
 {
@@ -569,16 +671,27 @@ _preprocess_hv(char *Buf, int Begin, int *End, int *Num, int Max_size)
   substituted = false;
   DBG_printf("---preprocess_hv: %*.*s\n", size, size, &Buf[Begin]);
 
+  if (!_has_hv(Buf, Begin, *End)) {
+    /* Without #v( the parser finds nothing. */
+    return false;
+  }
+
+  /* The values of the symbols may change on the next pass. */
+  line_is_stable = false;
+
   while (Begin < *End) {
     size = *End - Begin;
     DBG_printf("***Parsing chunk: %*.*s\n", size, size, &Buf[Begin]);
 
     if (ppparse_chunk(Buf, Begin, *End)) {
+      /* The value may come from a symbol of the including file. */
+      hcache_abort();
       substituted = true;
       DBG_printf("col_begin = %d; col_end = %d; result = %d\n", ppcol_begin, ppcol_end, ppresult);
       res_len = snprintf(res_buf, sizeof(res_buf), "%d", ppresult);
 
       if ((*Num + res_len - (ppcol_end - ppcol_begin)) >= Max_size) {
+        line_is_stable = false;
         gpmsg_verror(GPE_INTERNAL, NULL, "Flex buffer too small.");
         return false;
       }
@@ -623,6 +736,10 @@ _preprocess_hv_params(char *Buf, int Begin, int *End, int *Num, int Max_size)
   in_hv      = 0;
   hv_parenth = 0;
 
+  if (!_has_hv(Buf, Begin, *End)) {
+    return;
+  }
+
   DBG_printf("---preprocess_hv_params: %*.*s\n", *End, *End, Buf);
 
   for (i = Begin; i < *End; ++i) {
@@ -703,20 +820,13 @@ _preprocess_hv_params(char *Buf, int Begin, int *End, int *Num, int Max_size)
 /*------------------------------------------------------------------------------------------------*/
 
 static const char *
-_check_macro_params(char *Symbol, int Symlen)
+_macro_param_value(const symbol_t *Sym)
 {
-  const symbol_t *sym;
-  const pnode_t  *p;
-  const pnode_t  *p2;
-  const char     *subst;
+  const pnode_t *p;
+  const pnode_t *p2;
+  const char    *subst;
 
-  sym = gp_sym_get_symbol_len(state.stMacroParams, Symbol, Symlen);
-
-  if (sym == NULL) {
-    return NULL;
-  }
-
-  p = (const pnode_t *)gp_sym_get_symbol_annotation(sym);
+  p = (const pnode_t *)gp_sym_get_symbol_annotation(Sym);
 
   if (p == NULL) {
     return "";
@@ -729,11 +839,25 @@ _check_macro_params(char *Symbol, int Symlen)
   assert(PnIsString(p2));
 
   subst = PnString(p2);
+  return ((subst != NULL) ? subst : "");
+}
 
-  if (subst == NULL) {
-    return "";
+/*------------------------------------------------------------------------------------------------*/
+
+static const char *
+_check_macro_params(char *Symbol, int Symlen)
+{
+  const symbol_t *sym;
+  const char     *subst;
+
+  sym = gp_sym_get_symbol_len(state.stMacroParams, Symbol, Symlen);
+
+  if (sym == NULL) {
+    return NULL;
   }
 
+  subst = _macro_param_value(sym);
+
   /* check for a bad subsitution */
   return (((strlen(subst) == Symlen) && (strncmp(Symbol, subst, Symlen) == 0)) ? NULL : subst);
 }
@@ -758,6 +882,7 @@ _substitute_macro_param(char *Buf, int Begin, int *End, int *Num, int Max_size,
     len = strlen(sub);
 
     if ((*Num + len - mlen) >= Max_size) {
+      line_is_stable = false;
       gpmsg_verror(GPE_INTERNAL, NULL, "Flex buffer too small.");
       return false;
     }
@@ -773,6 +898,219 @@ _substitute_macro_param(char *Buf, int Begin, int *End, int *Num, int Max_size,
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* A substitute function which only notes the position of the identifier. */
+
+static gp_boolean
+_add_slot(char *Buf, int Begin, int *End, int *Num, int Max_size, int Level)
+{
+  if (slot_num >= slot_max) {
+    slot_max  = (slot_max == 0) ? 16 : (slot_max * 2);
+    slot_list = GP_Realloc(slot_list, slot_max * sizeof(macro_slot_t));
+  }
+
+  slot_list[slot_num].begin = Begin;
+  slot_list[slot_num].end   = *End;
+  slot_list[slot_num].parm  = -1;
+  ++slot_num;
+  return false;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Finds the identifiers of a macro line which _substitute_macro_param() would look up, and which of
+   them are the parameters of the macro. The lines of a while loop have no parameters of their own,
+   but a macro which contains the loop may replace their identifiers. */
+
+static void
+_compile_macro_line(const macro_head_t *Head, gp_boolean Is_while, macro_body_t *Body)
+{
+  char          *buf;
+  int            len;
+  int            num;
+  int            end;
+  unsigned int   i;
+  int            index;
+  const pnode_t *p;
+  const char    *name;
+  int            mlen;
+
+  if (Body->src_line == NULL) {
+    return;
+  }
+
+  len = strlen(Body->src_line);
+  buf = GP_Malloc(len + 2);
+  memcpy(buf, Body->src_line, len);
+  buf[len] = '\n';
+  buf[len + 1] = '\0';
+
+  num      = len + 1;
+  end      = num;
+  slot_num = 0;
+  _preprocess(buf, 0, &end, &num, num + 1, &_add_slot, 1);
+  free(buf);
+
+  if (slot_num == 0) {
+    return;
+  }
+
+  for (i = 0; (i < slot_num) && (!Is_while); ++i) {
+    mlen = slot_list[i].end - slot_list[i].begin;
+
+    /* If a parameter name is repeated, the last one has the argument. */
+    index = 0;
+    for (p = Head->parms; p != NULL; p = PnListTail(p)) {
+      name = PnSymbol(PnListHead(p));
+
+      if ((strlen(name) == mlen) &&
+          (((state.case_insensitive) ? strncasecmp(name, &Body->src_line[slot_list[i].begin], mlen) :
+                                       strncmp(name, &Body->src_line[slot_list[i].begin], mlen)) == 0)) {
+        slot_list[i].parm = index;
+      }
+
+      ++index;
+    }
+  }
+
+  Body->slots = GP_Malloc(slot_num * sizeof(macro_slot_t));
+  memcpy(Body->slots, slot_list, slot_num * sizeof(macro_slot_t));
+  Body->num_slots = slot_num;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Prepares the expansion of a macro or of a while loop, Ctx is its new source context. The body
+   is compiled at the first expansion, the arguments are taken once for all its lines. */
+
+void
+preprocess_macro_begin(source_context_t *Ctx, gp_boolean Is_while)
+{
+  macro_head_t           *head;
+  macro_body_t           *body;
+  const source_context_t *p;
+  const pnode_t          *parm;
+  const symbol_t         *sym;
+  int                     i;
+
+  head = Ctx->mac_head;
+
+  if (!head->compiled) {
+    for (body = head->body; body != NULL; body = body->next) {
+      _compile_macro_line(head, Is_while, body);
+    }
+
+    head->compiled = true;
+  }
+
+  Ctx->mac_expansion   = false;
+  Ctx->mac_outer_parms = false;
+
+  for (p = Ctx; p != NULL; p = p->prev) {
+    if (p->type == SRC_MACRO) {
+      Ctx->mac_expansion = true;
+
+      if ((p != Ctx) && (p->mac_head->parms != NULL)) {
+        Ctx->mac_outer_parms = true;
+      }
+    }
+  }
+
+  if ((!Is_while) && (head->parms != NULL)) {
+    Ctx->mac_args = GP_Malloc(eval_list_length(head->parms) * sizeof(const char *));
+
+    i = 0;
+    for (parm = head->parms; parm != NULL; parm = PnListTail(parm)) {
+      sym = gp_sym_get_symbol(state.stMacroParams, PnSymbol(PnListHead(parm)));
+      Ctx->mac_args[i] = (sym != NULL) ? _macro_param_value(sym) : NULL;
+      ++i;
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Copies the current line of the macro expansion Ctx into Buf, with the arguments in the slots of
+   the parameters. The result is the same as of _substitute_macro_param(). Returns -1 if the line
+   must go through the preprocessor instead: outside of an expansion, in a macro definition, or if
+   the line does not fit in the buffer. */
+
+int
+preprocess_macro_line(const source_context_t *Ctx, char *Buf, int Max_size)
+{
+  const macro_body_t *body;
+  const macro_slot_t *slot;
+  const char         *line;
+  const char         *sub;
+  int                 len;
+  int                 size;
+  int                 mlen;
+  int                 pos;
+  int                 n;
+  unsigned int        i;
+
+  body = Ctx->mac_body;
+
+  if ((body == NULL) || (!Ctx->mac_expansion) || (IN_MACRO_WHILE_DEFINITION)) {
+    return -1;
+  }
+
+  line = body->src_line;
+  len  = strlen(line);
+
+  if (len > (Max_size - 1)) {
+    return -1;
+  }
+
+  size = len + 1;
+  pos  = 0;
+  n    = 0;
+
+  for (i = 0; i < body->num_slots; ++i) {
+    slot = &body->slots[i];
+    mlen = slot->end - slot->begin;
+
+    if ((slot->parm >= 0) && (Ctx->mac_args != NULL) && (Ctx->mac_args[slot->parm] != NULL)) {
+      sub = Ctx->mac_args[slot->parm];
+
+      /* check for a bad subsitution */
+      if ((strlen(sub) == mlen) && (strncmp(&line[slot->begin], sub, mlen) == 0)) {
+        sub = NULL;
+      }
+    }
+    else if ((slot->parm >= 0) || Ctx->mac_outer_parms) {
+      sub = _check_macro_params((char *)&line[slot->begin], mlen);
+    }
+    else {
+      sub = NULL;
+    }
+
+    if (sub == NULL) {
+      continue;
+    }
+
+    len = strlen(sub);
+
+    if ((size + len - mlen) >= Max_size) {
+      return -1;
+    }
+
+    memcpy(&Buf[n], &line[pos], slot->begin - pos);
+    n += slot->begin - pos;
+    memcpy(&Buf[n], sub, len);
+    n   += len;
+    pos  = slot->end;
+    size += len - mlen;
+  }
+
+  len = strlen(&line[pos]);
+  memcpy(&Buf[n], &line[pos], len);
+  n += len;
+  Buf[n++] = '\n';
+  return n;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 static void
 _set_source_line(const char *Line, int Len, src_line_t *Src_line)
 {
@@ -820,14 +1158,20 @@ _in_macro_expansion(void)
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
-preprocess_line(char *Buf, int *Num, int Max_size)
+/* If Parms_replaced, preprocess_macro_line() has already put the macro parameters in the line.
+   Returns false if the result depends on the state of the pass: on the macro parameters or on the
+   values of the symbols. */
+
+gp_boolean
+preprocess_line(char *Buf, int *Num, int Max_size, gp_boolean Parms_replaced)
 {
   gp_boolean res;
   int        end;
+  int        from;
   gp_boolean macro_expansion;
 
-  end = *Num;
+  end            = *Num;
+  line_is_stable = true;
 
   if (IN_MACRO_WHILE_DEFINITION) {
     /* don't preprocess source line if in macro definition */
@@ -837,6 +1181,10 @@ preprocess_line(char *Buf, int *Num, int Max_size)
     macro_expansion = _in_macro_expansion();
 
     if (macro_expansion) {
+      line_is_stable = false;
+    }
+
+    if (macro_expansion && !Parms_replaced) {
       /* preprocess macro parameters */
       _preprocess(Buf, 0, &end, Num, Max_size, &_substitute_macro_param, 1);
     }
@@ -850,10 +1198,19 @@ preprocess_line(char *Buf, int *Num, int Max_size)
       _set_source_line(Buf, *Num, &state.src_list.last->curr_src_line);
     }
 
-    /* preprocess line */
+    /* Preprocess the line until no more substitution is found. A run begins at the first #define
+       of the previous run: the identifiers before it are not #defines, and there the scanner is
+       in the same state as at the beginning of the line. */
+    from = 0;
     do {
-      res  = _preprocess(Buf, 0, &end, Num, Max_size, &_substitute_define, 0);
-      res |= _preprocess_hv(Buf, 0, &end, Num, Max_size);
+      define_first = end;
+      res  = _preprocess(Buf, from, &end, Num, Max_size, &_substitute_define, 0);
+      from = define_first;
+
+      if (_preprocess_hv(Buf, 0, &end, Num, Max_size)) {
+        res  = true;
+        from = 0;
+      }
     }
     while (res);
 
@@ -867,4 +1224,54 @@ preprocess_line(char *Buf, int *Num, int Max_size)
     /* set current preprocessed source line if preprocessed asm file emission enabled */
     _set_source_line(Buf, *Num, &state.preproc.curr_src_line);
   }
+
+  return line_is_stable;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Sets the source lines of a line which was preprocessed on the first pass. */
+
+void
+preprocess_replay_line(const char *Src_line, int Src_size, const char *Buf, int Num)
+{
+  _set_source_line(Src_line, Src_size, &state.src_list.last->curr_src_line);
+
+  if (state.preproc.f != NULL) {
+    _set_source_line(Buf, Num, &state.preproc.curr_src_line);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Each pass begins with the #defines of the command line. */
+
+void
+preprocess_init_defines(const symbol_table_t *Cmd_defines)
+{
+  size_t i;
+  size_t n;
+
+  memset(define_filter, 0, sizeof(define_filter));
+
+  n = gp_sym_get_symbol_count(Cmd_defines);
+  for (i = 0; i < n; ++i) {
+    _define_filter_add(gp_sym_get_symbol_name(gp_sym_get_symbol_with_index(Cmd_defines, i)), 1);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+preprocess_add_define(const char *Name)
+{
+  _define_filter_add(Name, 1);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+preprocess_remove_define(const char *Name)
+{
+  _define_filter_add(Name, -1);
 }
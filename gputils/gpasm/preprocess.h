@@ -24,7 +24,13 @@ Boston, MA 02111-1307, USA.  */
 #define PREPROC_MAX_DEPTH       16
 
 /* from preprocess.c */
-extern void preprocess_line(char *Buf, int *Num, int Max_size);
+extern void preprocess_macro_begin(source_context_t *Ctx, gp_boolean Is_while);
+extern int preprocess_macro_line(const source_context_t *Ctx, char *Buf, int Max_size);
+extern gp_boolean preprocess_line(char *Buf, int *Num, int Max_size, gp_boolean Parms_replaced);
+extern void preprocess_replay_line(const char *Src_line, int Src_size, const char *Buf, int Num);
+extern void preprocess_init_defines(const symbol_table_t *Cmd_defines);
+extern void preprocess_add_define(const char *Name);
+extern void preprocess_remove_define(const char *Name);
 
 /* from ppscan.c */
 extern int ppcol_begin;
@@ -0,0 +1,349 @@
+/* Replay of the preprocessed source lines
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#include "stdhdr.h"
+
+#include "libgputils.h"
+#include "gpasm.h"
+#include "preprocess.h"
+#include "replay.h"
+
+/* The first pass keeps the lines which it has read from the source files and preprocessed. The
+   second pass takes them again instead of reading and preprocessing the files.
+
+   The result of the preprocessor depends on the text of the line and on the #defines. A line is
+   identified by its file, its offset in the file, the size of the flex buffer and a hash of all
+   #define and #undefine directives which were executed before it in the pass. If the second
+   pass finds no line with the same identity, it reads the file itself. The lines which depend on
+   other states (#v() and the macro parameters) or which have a message are not kept. */
+
+typedef struct replay_line {
+  const file_context_t *fc;             /* The source file, NULL if the slot is empty. */
+  size_t                begin;          /* The offsets of the line in the source file. */
+  size_t                end;
+  hash128_t             defines;        /* The #defines of the pass before the line. */
+  int                   max_size;       /* The size of the flex buffer. */
+  gp_boolean            in_definition;  /* The line belongs to a macro or while definition. */
+  size_t                text;           /* The preprocessed line in the text buffer. */
+  int                   text_size;      /* Zero if the line is the end of the file. */
+  size_t                src_line;       /* The source line of the listing in the text buffer. */
+  int                   src_size;
+} replay_line_t;
+
+static gp_boolean     enabled = false;
+static hash128_t      defines_hash;
+
+static replay_line_t *lines      = NULL;  /* Open hash table of the lines. */
+static size_t         lines_size = 0;     /* Power of 2. */
+static size_t         num_lines  = 0;
+
+static char          *text        = NULL;
+static size_t         text_length = 0;
+static size_t         text_size   = 0;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static size_t
+_slot(const file_context_t *Fc, size_t Begin, const hash128_t *Defines)
+{
+  size_t h;
+
+  h  = (size_t)Fc->id * 0x9e3779b1u;
+  h ^= Begin * 0x85ebca6bu;
+  h ^= (size_t)Defines->low.u32[0];
+  h ^= h >> 15;
+  return (h & (lines_size - 1));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static replay_line_t *
+_find(const file_context_t *Fc, size_t Begin, int Max_size, gp_boolean In_definition)
+{
+  replay_line_t *line;
+  size_t         i;
+
+  if (num_lines == 0) {
+    return NULL;
+  }
+
+  for (i = _slot(Fc, Begin, &defines_hash); lines[i].fc != NULL; i = (i + 1) & (lines_size - 1)) {
+    line = &lines[i];
+
+    if ((line->fc == Fc) && (line->begin == Begin) && (line->max_size == Max_size) &&
+        (line->in_definition == In_definition) &&
+        (memcmp(&line->defines, &defines_hash, sizeof(hash128_t)) == 0)) {
+      return line;
+    }
+  }
+
+  return NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_grow_table(void)
+{
+  replay_line_t *old;
+  size_t         old_size;
+  size_t         i;
+  size_t         j;
+
+  old      = lines;
+  old_size = lines_size;
+
+  lines_size = (old_size == 0) ? 1024 : (old_size * 2);
+  lines      = GP_Calloc(lines_size, sizeof(replay_line_t));
+
+  for (i = 0; i < old_size; ++i) {
+    if (old[i].fc != NULL) {
+      j = _slot(old[i].fc, old[i].begin, &old[i].defines);
+
+      while (lines[j].fc != NULL) {
+        j = (j + 1) & (lines_size - 1);
+      }
+
+      lines[j] = old[i];
+    }
+  }
+
+  if (old != NULL) {
+    free(old);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static size_t
+_add_text(const char *Data, int Size)
+{
+  size_t pos;
+
+  if ((text_length + Size) > text_size) {
+    text_size = (text_size == 0) ? (64 * 1024) : text_size;
+
+    while ((text_length + Size) > text_size) {
+      text_size *= 2;
+    }
+
+    text = GP_Realloc(text, text_size);
+  }
+
+  pos = text_length;
+  memcpy(&text[pos], Data, Size);
+  text_length += Size;
+  return pos;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+replay_enable(void)
+{
+  enabled = true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+gp_boolean
+replay_is_enabled(void)
+{
+  return enabled;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Both passes begin with the #defines of the command line. */
+
+void
+replay_begin_pass(void)
+{
+  gp_hash_init(&defines_hash);
+
+  if (state.pass == 1) {
+    replay_free();
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+replay_free(void)
+{
+  if (lines != NULL) {
+    free(lines);
+    lines = NULL;
+  }
+
+  if (text != NULL) {
+    free(text);
+    text = NULL;
+  }
+
+  lines_size  = 0;
+  num_lines   = 0;
+  text_length = 0;
+  text_size   = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Called when a #define is added, Value is its annotation in stDefines. */
+
+void
+replay_define(const char *Name, const pnode_t *Value)
+{
+  const pnode_t *p;
+  const char    *string;
+
+  if (!enabled) {
+    return;
+  }
+
+  gp_hash_str(&defines_hash, "#define", false);
+  gp_hash_str(&defines_hash, Name, state.case_insensitive);
+
+  for (p = Value; p != NULL; p = PnListTail(p)) {
+    assert(PnIsList(p));
+
+    if (PnIsString(PnListHead(p))) {
+      string = PnString(PnListHead(p));
+      gp_hash_str(&defines_hash, "s", false);
+      gp_hash_str(&defines_hash, (string != NULL) ? string : "", false);
+    }
+    else if (PnIsSymbol(PnListHead(p))) {
+      gp_hash_str(&defines_hash, "y", false);
+      gp_hash_str(&defines_hash, PnSymbol(PnListHead(p)), false);
+    }
+    else {
+      gp_hash_str(&defines_hash, "?", false);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+replay_undefine(const char *Name)
+{
+  if (!enabled) {
+    return;
+  }
+
+  gp_hash_str(&defines_hash, "#undefine", false);
+  gp_hash_str(&defines_hash, Name, state.case_insensitive);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* On the second pass, copies the line of Ctx which begins at the Begin offset in Buf, if the first
+   pass has kept it. Returns the length of the line and the offset of its end, or -1 if the line
+   must be read from the file. */
+
+int
+replay_fetch_line(const source_context_t *Ctx, size_t Begin, char *Buf, int Max_size, size_t *End)
+{
+  const replay_line_t *line;
+  gp_boolean           in_definition;
+
+  if ((state.pass != 2) || (Ctx->fc == NULL)) {
+    return -1;
+  }
+
+  in_definition = (IN_MACRO_WHILE_DEFINITION) ? true : false;
+  line          = _find(Ctx->fc, Begin, Max_size, in_definition);
+
+  if (line == NULL) {
+    return -1;
+  }
+
+  *End = line->end;
+
+  if (line->text_size > 0) {
+    memcpy(Buf, &text[line->text], line->text_size);
+    preprocess_replay_line(&text[line->src_line], line->src_size, Buf, line->text_size);
+  }
+
+  return line->text_size;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* On the first pass, keeps the line of Ctx which was read between the Begin and End offsets, and
+   which Buf holds preprocessed. Num is zero at the end of the file. */
+
+void
+replay_store_line(const source_context_t *Ctx, size_t Begin, size_t End, const char *Buf, int Num, int Max_size)
+{
+  replay_line_t *line;
+  const char    *src_line;
+  int            src_size;
+  gp_boolean     in_definition;
+  size_t         i;
+
+  if ((state.pass != 1) || (Ctx->fc == NULL)) {
+    return;
+  }
+
+  in_definition = (IN_MACRO_WHILE_DEFINITION) ? true : false;
+
+  if (_find(Ctx->fc, Begin, Max_size, in_definition) != NULL) {
+    /* The file has been included again in the same state. */
+    return;
+  }
+
+  if ((num_lines + 1) * 2 > lines_size) {
+    _grow_table();
+  }
+
+  i = _slot(Ctx->fc, Begin, &defines_hash);
+
+  while (lines[i].fc != NULL) {
+    i = (i + 1) & (lines_size - 1);
+  }
+
+  line = &lines[i];
+  line->fc            = Ctx->fc;
+  line->begin         = Begin;
+  line->end           = End;
+  line->defines       = defines_hash;
+  line->max_size      = Max_size;
+  line->in_definition = in_definition;
+  line->text_size     = Num;
+  ++num_lines;
+
+  if (Num > 0) {
+    line->text = _add_text(Buf, Num);
+
+    /* Most lines have no #define, their source line is the same text without the newline. */
+    src_line = Ctx->curr_src_line.line;
+    src_size = strlen(src_line);
+
+    if ((src_size <= Num) && (memcmp(src_line, Buf, src_size) == 0)) {
+      line->src_line = line->text;
+    }
+    else {
+      line->src_line = _add_text(src_line, src_size);
+    }
+
+    line->src_size = src_size;
+  }
+}
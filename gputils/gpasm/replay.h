@@ -0,0 +1,36 @@
+/* Replay of the preprocessed source lines
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#ifndef __REPLAY_H__
+#define __REPLAY_H__
+
+extern void replay_enable(void);
+extern gp_boolean replay_is_enabled(void);
+extern void replay_begin_pass(void);
+extern void replay_free(void);
+
+extern void replay_define(const char *Name, const pnode_t *Value);
+extern void replay_undefine(const char *Name);
+
+extern int replay_fetch_line(const source_context_t *Ctx, size_t Begin, char *Buf, int Max_size, size_t *End);
+extern void replay_store_line(const source_context_t *Ctx, size_t Begin, size_t End, const char *Buf, int Num,
+                              int Max_size);
+
+#endif
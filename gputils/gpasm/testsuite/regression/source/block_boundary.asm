@@ -0,0 +1,1653 @@
+; BLOCK_BOUNDARY.ASM
+
+; This file tests the lines which cross the boundaries of the 64 KiB blocks
+; the source files are read in. The second one has the CR and the LF in
+; two blocks.
+
+	processor p16f887
+	radix	dec
+
+	org	0
+	nolist
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+	list
+;gggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggggg
+	movlw	0x56		; this line crosses the first block boundary
+	addlw	0x11
+	nolist
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff
+;;;;;;;;;;;;;;;;;
+	list
+;hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh
+	movlw	0x78		; CR and LF in two blocks
+	addlw	0x12
+	end
@@ -0,0 +1,18 @@
+; CRLF.ASM
+
+; This file tests the CR LF line endings, the CR before the LF is dropped.
+
+	processor p16f887
+	radix	dec
+
+value	equ	0x25
+
+load	macro	v
+	movlw	v		; comment in macro
+	endm
+
+	org	0
+	load	value
+	addlw	0x10
+	goto	$
+	end
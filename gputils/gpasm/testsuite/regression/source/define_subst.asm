@@ -0,0 +1,65 @@
+; DEFINE_SUBST.ASM
+
+; This file tests the substitution of the #defines: nested #defines, #defines
+; with parameters whose arguments follow the substituted text, #v() in the
+; body of a #define and #undefine.
+
+	list	p=16f887
+	radix	dec
+
+; nested #defines
+#define LEVEL3	0x03
+#define LEVEL2	LEVEL3 + LEVEL3
+#define LEVEL1	LEVEL2 + LEVEL3
+#define LEVEL0	LEVEL1
+
+; #defines with parameters
+#define ADD(a, b)	((a) + (b))
+#define MUL(a, b)	((a) * (b))
+#define OPERATION	ADD
+#define OPEN		MUL(
+#define APPLY(f, x)	f(x, x)
+
+; #v() in the body of a #define
+index	set	2
+value1	equ	0x11
+value2	equ	0x22
+value3	equ	0x33
+#define VALUE		value#v(index)
+#define VALUE_AT(i)	value#v(i)
+
+	org	0
+	movlw	LEVEL0
+	movlw	LEVEL1 + LEVEL0
+	movlw	OPERATION(1, 2)
+	movlw	OPERATION(LEVEL3, OPERATION(4, 5))
+	movlw	OPEN 3, 4)
+	movlw	APPLY(ADD, 6)
+	movlw	APPLY(OPERATION, LEVEL2)
+	movlw	VALUE
+index	set	3
+	movlw	VALUE
+	movlw	VALUE_AT(1)
+	movlw	VALUE_AT(index - 1)
+	movlw	value#v(index) + VALUE
+
+; #undefine of a #define of the source
+#define SOURCE	0x66
+	movlw	SOURCE
+#undefine SOURCE
+SOURCE	equ	0x77
+	movlw	SOURCE
+
+; the command line #defines are in an outer table, #undefine does not remove them
+	movlw	CMDLINE
+#ifdef CMDLINE
+	movlw	0x01
+#endif
+#undefine CMDLINE
+#ifdef CMDLINE
+	movlw	0x02
+#else
+	movlw	0x03
+#endif
+	movlw	CMDLINE
+	end
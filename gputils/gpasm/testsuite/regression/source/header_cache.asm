@@ -0,0 +1,20 @@
+; HEADER_CACHE.ASM
+
+; This file tests the --header-cache option: the processor header and an
+; include-guarded header are included twice.
+
+        list    p=16f887
+        include p16f887.inc
+        include header_cache.inc
+        include p16f887.inc
+        include header_cache.inc
+
+        org     0
+        movlw   HC_VALUE
+        movwf   PORTA
+  ifdef HC_EXTRA
+        movlw   HC_EXTRA
+  endif
+        bsf     STATUS, RP0
+        clrf    TRISA
+        end
@@ -0,0 +1,57 @@
+; MACRO_PARAMS.ASM
+
+; This file tests the substitution of the macro parameters: nested macros,
+; while loops in macros and parameters which occur several times in a line.
+
+        list    p=16f887
+
+        cblock  0x20
+          count, value, temp
+        endc
+
+; A parameter occurs several times in a line and in the label.
+twice   macro   reg, val
+reg#v(val)_lbl:
+        movlw   val + val * 2
+        movwf   reg
+        addwf   reg, 1
+        endm
+
+; The inner macro has the same parameter names as the outer one.
+inner   macro   reg, val
+        movlw   val
+        xorwf   reg, 0
+        endm
+
+outer   macro   reg, val, n
+        inner   reg, val
+        inner   reg, val + n
+        twice   reg, n
+        endm
+
+; A while loop in a macro, with a nested macro in the loop.
+spread  macro   reg, first, num
+        local   i
+i = 0
+        while   i < num
+        inner   reg, first + i
+        movwf   reg + i
+i += 1
+        endw
+        endm
+
+; The parameters are prefixes of each other.
+names   macro   p, pq, pqr
+        movlw   p + pq + pqr
+        movlw   pqr - pq - p
+        movwf   value
+        endm
+
+        org     0
+        twice   count, 1
+        outer   value, 2, 3
+        spread  temp, 0x10, 3
+        spread  count, 5, 2
+        names   1, 2, 4
+        names   temp, value, count
+        end
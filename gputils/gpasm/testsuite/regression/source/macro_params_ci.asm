@@ -0,0 +1,30 @@
+; MACRO_PARAMS_CI.ASM
+
+; This file tests the substitution of the macro parameters in case-insensitive
+; mode: the parameters are used with other cases.
+
+        list    p=16f887
+
+        cblock  0x20
+          Count, Value
+        endc
+
+Inner   macro   Reg, Val
+        movlw   VAL
+        xorwf   reg, 0
+        endm
+
+Outer   macro   Reg, Val, N
+        local   i
+i = 0
+        while   I < n
+        inner   REG, val + i
+        MOVWF   Reg
+i += 1
+        endw
+        endm
+
+        org     0
+        OUTER   count, 2, 3
+        outer   VALUE, 0x10, 2
+        END
@@ -0,0 +1,12 @@
+; NO_NEWLINE.ASM
+
+; This file tests a last line without newline, in the main file and in an
+; include file.
+
+	processor p16f887
+
+	org	0
+	movlw	0x9a
+	#include "no_newline.inc"
+	addlw	0x02
+	end
\ No newline at end of file
@@ -0,0 +1,49 @@
+; REPLAY_SOURCE.ASM
+
+; This file tests the --replay-source option: the second pass reads the lines
+; of the first one. The defines change in the middle of the file, a file is
+; included twice and defines a macro which is used from a file and a macro.
+
+        list    p=16f887
+        include p16f887.inc
+
+#define VALUE   0x11
+#define REG(n)  (0x20 + n)
+
+        org     0
+        movlw   VALUE
+        movwf   REG(1)
+
+#undefine VALUE
+#define VALUE   0x22
+
+        movlw   VALUE
+        movwf   REG(2)
+
+        include replay_source.inc
+
+#undefine VALUE
+#define VALUE   0x33
+
+        include replay_source.inc
+
+i = 0
+  while i < 3
+reg#v(i)  equ   REG(i)
+        movlw   VALUE + i
+        movwf   reg#v(i)
+i += 1
+  endw
+
+load    macro   n
+        store   n
+        movwf   reg#v(n)
+        endm
+
+        load    0
+#undefine VALUE
+#define VALUE   0x44
+        load    2
+
+        movf    reg0, W
+        end
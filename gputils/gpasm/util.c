@@ -28,6 +28,7 @@ Boston, MA 02111-1307, USA.  */
 #include "gpmsg.h"
 #include "directive.h"
 #include "coff.h"
+#include "hcache.h"
 
 #define STR_INHX8M                  "inhx8m"
 #define STR_INHX8S                  "inhx8s"
@@ -676,6 +677,8 @@ set_global(const char *Name, gpasmVal Value, enum gpasmValTypes Type, gp_boolean
   unsigned int class;
   char*        coff_name;
 
+  hcache_record_symbol(Name, Value, Type, Proc_dependent, Has_no_value);
+
   /* Search the entire stack (i.e. include macro's local symbol tables) for the symbol.
      If not found, then add it to the global symbol table.  */
   sym = gp_sym_get_symbol(state.stTop, Name);
@@ -1212,8 +1215,10 @@ macro_append(void)
 {
   macro_body_t *body = GP_Malloc(sizeof(*body));
 
-  body->src_line = NULL;
-  body->next     = NULL;            /* make sure it's terminated */
+  body->src_line  = NULL;
+  body->slots     = NULL;
+  body->num_slots = 0;
+  body->next      = NULL;           /* make sure it's terminated */
 
   *state.mac_prev = body;           /* append this to the chain */
   state.mac_prev  = &body->next;    /* this is the new end of the chain */
@@ -27,24 +27,25 @@ Boston, MA 02111-1307, USA.  */
 #include "gplink.h"
 #include "cod.h"
 
-static DirBlockInfo *main_dir;
+static DirBlockInfo   *main_dir;
+static symbol_table_t *file_table;
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Assign each file name unique file number. A file may appear in the symbol table more than once. */
+/* Assign each file name unique file number. A file may appear in the symbol table more than once.
+   The numbers are kept in the file table, because the COFF writer numbers the symbols meanwhile. */
 
 static void
 _assign_file_id(void)
 {
-  symbol_table_t *file_table;
-  gp_symbol_t    *symbol;
-  gp_aux_t       *aux;
-  symbol_t       *sym;
-  int             file_id;
-  int            *value;
+  const gp_symbol_t *symbol;
+  const gp_aux_t    *aux;
+  symbol_t          *sym;
+  int                file_id;
+  int               *value;
 
   /* Build a case sensitive file table. */
-  file_table = gp_sym_push_table(NULL, false);
+  file_table = gp_sym_push_arena_table(NULL, false);
   file_id    = 0;
 
   symbol = state.object->symbol_list.first;
@@ -54,26 +55,39 @@ _assign_file_id(void)
       assert(aux != NULL);
       sym = gp_sym_get_symbol(file_table, aux->_aux_symbol._aux_file.filename);
 
-      if (sym != NULL) {
-        /* Fetch the file number. */
-        value = (int *)gp_sym_get_symbol_annotation(sym);
-      }
-      else {
+      if (sym == NULL) {
         /* The file hasn't been assigned a value. */
         value  = (int *)GP_Malloc(sizeof(int));
         *value = file_id++;
         sym    = gp_sym_add_symbol(file_table, aux->_aux_symbol._aux_file.filename);
         gp_sym_annotate_symbol(sym, value);
       }
-
-      symbol->number = *value;
     }
 
     symbol = symbol->next;
   }
+}
 
-  /* Destroy the table. */
-  file_table = gp_sym_pop_table(file_table);
+/*------------------------------------------------------------------------------------------------*/
+
+/* The file number of a C_FILE symbol. */
+
+static int
+_file_id(const gp_symbol_t *Symbol)
+{
+  static const gp_symbol_t *last_symbol = NULL;
+  static int                last_id     = 0;
+
+  const symbol_t *sym;
+
+  if (Symbol != last_symbol) {
+    sym = gp_sym_get_symbol(file_table, Symbol->aux_list.first->_aux_symbol._aux_file.filename);
+    assert(sym != NULL);
+    last_id     = *(const int *)gp_sym_get_symbol_annotation(sym);
+    last_symbol = Symbol;
+  }
+
+  return last_id;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -182,7 +196,7 @@ _write_source_file_block(void)
       fb = gp_cod_block_append(&main_dir->file, gp_cod_block_new());
     }
 
-    if ((symbol->class == C_FILE) && (symbol->number == file_id)) {
+    if ((symbol->class == C_FILE) && (_file_id(symbol) == file_id)) {
       /* Skip the duplicate file symbols. */
       file_id++;
 
@@ -255,16 +269,16 @@ _write_debug(void)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* init_cod - Initialize the .cod file. */
+/* init_cod - Initialize the .cod file, return false if the file could not be created. */
 
-void
-cod_init(void)
+gp_boolean
+cod_init(int Num_errors)
 {
   if (state.cod_file != OUT_NAMED) {
     snprintf(state.cod_file_name, sizeof(state.cod_file_name), "%s.cod", state.base_file_name);
   }
 
-  if ((gp_num_errors > 0) || (state.cod_file == OUT_SUPPRESS)) {
+  if ((Num_errors > 0) || (state.cod_file == OUT_SUPPRESS)) {
     state.cod.f       = NULL;
     state.cod.enabled = false;
     unlink(state.cod_file_name);
@@ -273,19 +287,22 @@ cod_init(void)
     state.cod.f = fopen(state.cod_file_name, "wb");
 
     if (state.cod.f == NULL) {
-      perror(state.cod_file_name);
-      exit(1);
+      gp_error("%s: %s", state.cod_file_name, strerror(errno));
+      state.cod.enabled = false;
+      main_dir = NULL;
+      return false;
     }
     state.cod.enabled = true;
   }
 
   if (!state.cod.enabled) {
     main_dir = NULL;
-    return;
+    return true;
   }
 
   main_dir = gp_cod_init_dir_block(state.cod_file_name, "gplink");
   _assign_file_id();
+  return true;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -336,7 +353,7 @@ cod_lst_line(int line_type)
 
   record = &lb->block[dbi->list.offset];
 
-  record[COD_LS_SFILE] = state.lst.src->symbol->number;
+  record[COD_LS_SFILE] = _file_id(state.lst.src->symbol);
   record[COD_LS_SMOD]  = smod_flag;
 
   /* Write the source file line number corresponding to the list file line number. */
@@ -350,15 +367,16 @@ cod_lst_line(int line_type)
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
+gp_boolean
 cod_close_file(void)
 {
   unsigned int  length;
   gp_boolean    truncated;
   const char   *name;
+  gp_boolean    written;
 
   if (!state.cod.enabled) {
-    return;
+    return true;
   }
 
   name = gp_processor_name(state.processor, 2);
@@ -379,8 +397,15 @@ cod_close_file(void)
   gp_cod_write_code(state.class, state.i_memory, main_dir);
   _write_debug();
   gp_cod_enumerate_directory(main_dir);
-  gp_cod_write_directory(state.cod.f, main_dir);
+  written = gp_cod_write_directory(state.cod.f, main_dir);
   gp_cod_free_directory(main_dir);
-  main_dir = NULL;
+  main_dir   = NULL;
+  file_table = gp_sym_pop_table(file_table);
   fclose(state.cod.f);
+
+  if (!written) {
+    gp_error("Could not write cod file: %s", state.cod_file_name);
+  }
+
+  return written;
 }
@@ -28,8 +28,8 @@ Boston, MA 02111-1307, USA.  */
 #define COD_NORMAL_LST_LINE     2
 #define COD_LAST_LST_LINE       3
 
-extern void cod_init(void);
-extern void cod_close_file(void);
+extern gp_boolean cod_init(int Num_errors);
+extern gp_boolean cod_close_file(void);
 extern void cod_lst_line(int line_type);
 
 #endif
@@ -39,6 +39,7 @@ Boston, MA 02111-1307, USA.  */
 #include "lst.h"
 #include "map.h"
 #include "script.h"
+#include "report.h"
 
 extern int yyparse(void);
 extern int yydebug;
@@ -48,12 +49,51 @@ extern int yydebug;
 struct gplink_state state;
 static gp_boolean   processor_mismatch_warning;
 static gp_boolean   enable_cinit_wanings;
-
-#define GET_OPTIONS "a:b:BcCdf:hI:jlmo:O:p:Pqrs:S:t:u:vwW"
+static gp_boolean   show_kept_sections;
+
+/* A definition of a symbol in an archive. */
+typedef struct archive_def {
+  unsigned int        archive;          /* Number of the archive in the archive list. */
+  gp_archive_t       *member;           /* The member that defines the symbol. */
+  struct archive_def *next;             /* Definition in a later archive. */
+} archive_def_t;
+
+/* The annotation of the symbols in state.symbol.archive. */
+typedef struct archive_sym {
+  archive_def_t *first;
+  archive_def_t *last;
+  gp_boolean     waiting;               /* The archives wait for the symbol. */
+} archive_sym_t;
+
+/* A missing symbol that an archive is able to define. */
+typedef struct archive_wait {
+  hash128_t     hash;                   /* Order of the symbol in state.symbol.missing. */
+  const char   *name;
+  gp_archive_t *member;
+} archive_wait_t;
+
+typedef struct archive_heap {
+  archive_wait_t *entries;
+  size_t          num_entries;
+  size_t          max_entries;
+} archive_heap_t;
+
+/* An object or archive of the command line. */
+typedef struct coff_file {
+  char                *full_name;
+  gp_coff_t            type;
+  gp_object_t         *object;
+  gp_archive_t        *archive;
+  gp_message_buffer_t  messages;        /* The messages of the reading on a thread. */
+} coff_file_t;
+
+#define GET_OPTIONS "a:b:BcCdf:hI:jJ:lmo:O:p:Pqrs:S:t:u:vwW"
 
 enum {
   OPT_MPLINK_COMPATIBLE = 0x100,
-  OPT_STRICT_OPTIONS
+  OPT_STRICT_OPTIONS,
+  OPT_SHOW_KEPT_SECTIONS,
+  OPT_TIME_REPORT
 #ifdef GPUTILS_DEBUG
   , OPT_DUMP_COFF
 #endif
@@ -71,6 +111,7 @@ static struct option longopts[] =
   { "help",                 no_argument,       NULL, 'h' },
   { "include",              required_argument, NULL, 'I' },
   { "no-save-local",        no_argument,       NULL, 'j' },
+  { "jobs",                 required_argument, NULL, 'J' },
   { "no-list",              no_argument,       NULL, 'l' },
   { "map",                  no_argument,       NULL, 'm' },
   { "output",               required_argument, NULL, 'o' },
@@ -81,8 +122,10 @@ static struct option longopts[] =
   { "use-shared",           no_argument,       NULL, 'r' },
   { "script",               required_argument, NULL, 's' },
   { "stack",                required_argument, NULL, 't' },
+  { "time-report",          optional_argument, NULL, OPT_TIME_REPORT },
   { "strict",               required_argument, NULL, 'S' },
   { "strict-options",       no_argument,       NULL, OPT_STRICT_OPTIONS },
+  { "show-kept-sections",   no_argument,       NULL, OPT_SHOW_KEPT_SECTIONS },
   { "macro",                required_argument, NULL, 'u' },
   { "version",              no_argument,       NULL, 'v' },
   { "processor-mismatch",   no_argument,       NULL, 'w' },
@@ -115,6 +158,7 @@ _show_usage(void)
   printf("  -h, --help                     Show this usage message.\n");
   printf("  -I DIR, --include DIR          Specify include directory.\n");
   printf("  -j, --no-save-local            Disable the save of local registers to COD file.\n");
+  printf("  -J N, --jobs N                 Read, patch and write on N threads. [1]\n");
   printf("  -l, --no-list                  Disable list file output.\n");
   printf("  -m, --map                      Output a map file.\n");
   printf("      --mplink-compatible        MPLINK compatibility mode.\n");
@@ -125,7 +169,10 @@ _show_usage(void)
   printf("  -q, --quiet                    Quiet.\n");
   printf("  -r, --use-shared               Use shared memory if necessary.\n");
   printf("  -s FILE, --script FILE         Linker script.\n");
+  printf("      --show-kept-sections       Show why the sections are not removed as dead sections.\n");
   printf("  -t SIZE, --stack SIZE          Create a stack section.\n");
+  printf("      --time-report[=FILE]       Report the time and memory of the link phases on stderr,\n"
+         "                                   or into the FILE in JSON format.\n");
   printf("  -S [0|1|2], --strict [0|1|2]   Set the strict level of the missing symbol.\n"
          "                                     0: This is the default. No message.\n"
          "                                     1: Show warning message if there is missing symbol.\n"
@@ -229,87 +276,310 @@ _archive_append(gp_archive_t *Archive, const char *Name)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Scan the archive for missing symbol definitions.  This has to be done
-   recursively.  The order of the archive members is unknown and there
-   might be inter member dependancies.  Scan the archive muliple times.
-   Stop whenever a complete pass through the archive happens and no
-   objects are added. */
+/* Add a heap entry, the heap is ordered by the hashes of the symbols. */
+
+static void
+_heap_push(archive_heap_t *Heap, const hash128_t *Hash, const char *Name, gp_archive_t *Member)
+{
+  archive_wait_t *entries;
+  size_t          i;
+  size_t          parent;
+
+  if (Heap->num_entries >= Heap->max_entries) {
+    Heap->max_entries = (Heap->max_entries == 0) ? 64 : (Heap->max_entries * 2);
+    Heap->entries     = (archive_wait_t *)GP_Realloc(Heap->entries, Heap->max_entries * sizeof(archive_wait_t));
+  }
+
+  entries = Heap->entries;
+  i       = Heap->num_entries++;
+  while (i > 0) {
+    parent = (i - 1) / 2;
+    if (gp_sym_compare_hash(&entries[parent].hash, Hash) <= 0) {
+      break;
+    }
+
+    entries[i] = entries[parent];
+    i          = parent;
+  }
+
+  entries[i].hash   = *Hash;
+  entries[i].name   = Name;
+  entries[i].member = Member;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Take the entry with the smallest hash from the heap. */
 
 static gp_boolean
-_scan_index(symbol_table_t *Table)
+_heap_pop(archive_heap_t *Heap, archive_wait_t *Entry)
 {
-  const symbol_t *sym_miss;
-  const symbol_t *sym_arch;
-  gp_archive_t   *member;
-  gp_object_t    *object;
+  archive_wait_t *entries;
+  archive_wait_t  last;
+  size_t          num;
   size_t          i;
-  int             num_added;
-  const char     *name;
-  char           *object_name;
-  gp_boolean      modified;
+  size_t          child;
 
-  num_added = 1; /* initalize to 1 so while loop can be entered */
-  modified  = false;
-  while (num_added != 0) {
-    num_added = 0;
-    for (i = 0; i < gp_sym_get_symbol_count(state.symbol.missing); ++i) {
-      sym_miss = gp_sym_get_symbol_with_index(state.symbol.missing, i);
-      name     = gp_sym_get_symbol_name(sym_miss);
-      assert(name != NULL);
-      /* Search for missing symbol name in archive symbol table. */
-      sym_arch = gp_sym_get_symbol(Table, name);
-
-      if (sym_arch != NULL) {
-        /* Fetch the archive member, convert its binary data to an object
-           file, and add the object to the object list. */
-        member      = gp_sym_get_symbol_annotation(sym_arch);
-        object_name = gp_archive_member_name(member);
-        object      = gp_convert_file(object_name, &member->data);
-        _object_append(object);
-        gp_cofflink_add_symbols(state.symbol.extern_global, state.symbol.missing, object);
-        /* The symbol tables have been modified. Need to take another
-           pass to make sure we get everything. */
-        num_added++;
-        modified = true;
-        free(object_name);
-        /* This branch of the table has been modified. Go to the next one. */
-        break;
+  if (Heap->num_entries == 0) {
+    return false;
+  }
+
+  entries = Heap->entries;
+  *Entry  = entries[0];
+  num     = --Heap->num_entries;
+  last    = entries[num];
+  i       = 0;
+  while ((child = (2 * i) + 1) < num) {
+    if (((child + 1) < num) && (gp_sym_compare_hash(&entries[child + 1].hash, &entries[child].hash) < 0)) {
+      ++child;
+    }
+
+    if (gp_sym_compare_hash(&last.hash, &entries[child].hash) <= 0) {
+      break;
+    }
+
+    entries[i] = entries[child];
+    i          = child;
+  }
+
+  entries[i] = last;
+  return true;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Read the symbol indexes of all archives into one table. A symbol gets the list of its
+   definitions, in the order of the archives. In one archive the first definition wins. */
+
+static unsigned int
+_read_archive_indexes(void)
+{
+  archivelist_t   *arlist;
+  symbol_table_t  *archive_tbl;
+  symbol_table_t  *index_tbl;
+  const symbol_t  *sym;
+  symbol_t        *sym_arch;
+  archive_sym_t   *arch;
+  archive_def_t   *def;
+  const char      *name;
+  size_t           i;
+  unsigned int     num_archives;
+
+  state.symbol.archive = gp_sym_push_arena_table(NULL, false);
+
+  num_archives = 0;
+  for (arlist = state.archives; arlist != NULL; arlist = arlist->next) {
+    /* If necessary, build a symbol index for the archive. */
+    if (gp_archive_have_index(arlist->archive) == 0) {
+      archive_tbl = gp_sym_push_arena_table(NULL, true);
+      gp_archive_make_index(arlist->archive, archive_tbl);
+      arlist->archive  = gp_archive_add_index(archive_tbl, arlist->archive);
+      arlist->no_index = true;
+      archive_tbl = gp_sym_pop_table(archive_tbl);
+    }
+
+    /* Read the symbol index. */
+    index_tbl = gp_sym_push_arena_table(NULL, false);
+    gp_archive_read_index(index_tbl, arlist->archive);
+
+    for (i = 0; i < gp_sym_get_symbol_count(index_tbl); ++i) {
+      sym  = gp_sym_get_symbol_with_index(index_tbl, i);
+      name = gp_sym_get_symbol_name(sym);
+
+      sym_arch = gp_sym_get_symbol(state.symbol.archive, name);
+      if (sym_arch == NULL) {
+        sym_arch = gp_sym_add_symbol(state.symbol.archive, name);
+        arch     = (archive_sym_t *)GP_Calloc(1, sizeof(archive_sym_t));
+        gp_sym_annotate_symbol(sym_arch, arch);
       }
+      else {
+        arch = (archive_sym_t *)gp_sym_get_symbol_annotation(sym_arch);
+      }
+
+      def          = (archive_def_t *)GP_Malloc(sizeof(archive_def_t));
+      def->archive = num_archives;
+      def->member  = (gp_archive_t *)gp_sym_get_symbol_annotation(sym);
+      def->next    = NULL;
+
+      if (arch->last == NULL) {
+        arch->first = def;
+      }
+      else {
+        arch->last->next = def;
+      }
+      arch->last = def;
     }
+
+    index_tbl = gp_sym_pop_table(index_tbl);
+    ++num_archives;
   }
 
-  return modified;
+  return num_archives;
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-static gp_boolean
-_scan_archive(gp_archive_t *Archive, const char *Name)
+/* Free the archive symbol table. */
+
+static void
+_free_archive_indexes(void)
+{
+  const symbol_t *sym;
+  archive_sym_t  *arch;
+  archive_def_t  *def;
+  archive_def_t  *next;
+  size_t          i;
+
+  for (i = 0; i < gp_sym_get_symbol_count(state.symbol.archive); ++i) {
+    sym  = gp_sym_get_symbol_with_index(state.symbol.archive, i);
+    arch = (archive_sym_t *)gp_sym_get_symbol_annotation(sym);
+
+    for (def = arch->first; def != NULL; def = next) {
+      next = def->next;
+      free(def);
+    }
+
+    free(arch);
+  }
+
+  state.symbol.archive = gp_sym_pop_table(state.symbol.archive);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* A symbol got into the missing table. If some archives define it, then let those wait for it.
+   Every symbol is looked up only once, because a defined symbol never gets missing again. */
+
+static void
+_wait_missing_symbol(archive_heap_t *Heaps, const char *Name)
 {
+  const symbol_t *sym_miss;
+  const symbol_t *sym_arch;
+  archive_sym_t  *arch;
+  archive_def_t  *def;
+
+  sym_arch = gp_sym_get_symbol(state.symbol.archive, Name);
+  if (sym_arch == NULL) {
+    return;
+  }
+
+  arch = (archive_sym_t *)gp_sym_get_symbol_annotation(sym_arch);
+  if (arch->waiting) {
+    return;
+  }
+
+  sym_miss = gp_sym_get_symbol(state.symbol.missing, Name);
+  assert(sym_miss != NULL);
+
+  arch->waiting = true;
+  for (def = arch->first; def != NULL; def = def->next) {
+    _heap_push(&Heaps[def->archive], gp_sym_get_symbol_hash(sym_miss), gp_sym_get_symbol_name(sym_arch),
+               def->member);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Fetch the archive member, convert its binary data to an object file, and add the object to
+   the object list. */
+
+static void
+_load_archive_member(archive_heap_t *Heaps, gp_archive_t *Member)
+{
+  gp_object_t       *object;
+  const gp_symbol_t *symbol;
+  char              *object_name;
+
+  object_name = gp_archive_member_name(Member);
+  object      = gp_convert_file(object_name, &Member->data);
+  _object_append(object);
+  gp_cofflink_add_symbols(state.symbol.extern_global, state.symbol.missing, object);
+  free(object_name);
+
+  /* The new references of the object. */
+  for (symbol = object->symbol_list.first; symbol != NULL; symbol = symbol->next) {
+    if ((symbol->class == C_EXT) && (symbol->name[0] != '.') && (symbol->section_number == N_UNDEF) &&
+        (gp_sym_get_symbol(state.symbol.missing, symbol->name) != NULL)) {
+      _wait_missing_symbol(Heaps, symbol->name);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Load the archive members that define missing symbols. The order of the archive members is
+   unknown and there might be inter member dependancies. The archives are visited in their
+   order. In an archive the missing symbol that comes first in the missing symbol table is
+   resolved first, until the archive can not resolve any more. After the last archive, the
+   visits are started again as long as any member was loaded. Each archive has a heap of the
+   missing symbols it defines, so no missing symbol has to be searched repeatedly. An archive
+   without symbol index is reported on every visit. */
+
+static void
+_scan_archives(void)
+{
+  archive_heap_t *heaps;
+  archive_wait_t  entry;
+  archivelist_t  *arlist;
+  unsigned int    num_archives;
+  unsigned int    i;
   gp_boolean      modified;
-  symbol_table_t *archive_tbl;
 
-  state.symbol.archive = gp_sym_push_table(NULL, false);
+  num_archives = _read_archive_indexes();
+  heaps        = (archive_heap_t *)GP_Calloc(num_archives, sizeof(archive_heap_t));
 
-  /* If necessary, build a symbol index for the archive. */
-  if (gp_archive_have_index(Archive) == 0) {
-    archive_tbl = gp_sym_push_table(NULL, true);
-    gp_archive_make_index(Archive, archive_tbl);
-    Archive = gp_archive_add_index(archive_tbl, Archive);
-    gp_warning("\"%s\" is missing symbol index.", Name);
-    archive_tbl = gp_sym_pop_table(archive_tbl);
+  for (i = 0; i < gp_sym_get_symbol_count(state.symbol.missing); ++i) {
+    _wait_missing_symbol(heaps, gp_sym_get_symbol_name(gp_sym_get_symbol_with_index(state.symbol.missing, i)));
   }
 
-  /* Read the symbol index. */
-  gp_archive_read_index(state.symbol.archive, Archive);
+  modified = false;
+  arlist   = state.archives;
+  i        = 0;
+  while (true) {
+    if (arlist->no_index) {
+      gp_warning("\"%s\" is missing symbol index.", arlist->name);
+    }
 
-  /* Scan the symbol index for symbols in the missing symbol table.
-     If found, add the object to state.objects. */
-  modified = _scan_index(state.symbol.archive);
+    while (_heap_pop(&heaps[i], &entry)) {
+      if (gp_sym_get_symbol(state.symbol.missing, entry.name) == NULL) {
+        /* An other member has defined it since. */
+        continue;
+      }
 
-  state.symbol.archive = gp_sym_pop_table(state.symbol.archive);
+      _load_archive_member(heaps, entry.member);
+      modified = true;
+    }
+
+    if (_count_missing() == 0) {
+      /* No more missing references, no need to continue. */
+      break;
+    }
+    else if ((i + 1) == num_archives) {
+      if (!modified) {
+        /* Quit */
+        break;
+      }
+
+      /* At least one object was loaded from an archive and there are
+         still missing symbols. Scan all the archives again. */
+      modified = false;
+      arlist   = state.archives;
+      i        = 0;
+    }
+    else {
+      arlist = arlist->next;
+      ++i;
+    }
+  }
+
+  for (i = 0; i < num_archives; ++i) {
+    if (heaps[i].entries != NULL) {
+      free(heaps[i].entries);
+    }
+  }
 
-  return modified;
+  free(heaps);
+  _free_archive_indexes();
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -405,8 +675,6 @@ static void
 _build_tables(void)
 {
   gp_object_t           *object;
-  archivelist_t         *arlist;
-  gp_boolean             modified;
   size_t                 i;
   const symbol_t        *sym;
   const char            *name;
@@ -423,32 +691,7 @@ _build_tables(void)
   /* All of the objects have been scanned. If there are remaining references
      to symbols, then the archives must contain the missing references. */
   if ((_count_missing() > 0) && (state.archives != NULL)) {
-    modified = false;
-    arlist   = state.archives;
-    while (true) {
-      if (_scan_archive(arlist->archive, arlist->name)) {
-        modified = true;
-      }
-      if (_count_missing() == 0) {
-        /* No more missing references, no need to continue. */
-        break;
-      }
-      else if (arlist->next == NULL) {
-        if (modified) {
-          /* At least one object was loaded from an archive and there are
-             still missing symbols. Scan all the archives again. */
-          modified = false;
-          arlist   = state.archives;
-        }
-        else {
-          /* Quit */
-          break;
-        }
-      }
-      else {
-        arlist = arlist->next;
-      }
-    }
+    _scan_archives();
   }
 
   _search_idata();
@@ -493,18 +736,15 @@ _build_tables(void)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Read a coff object or archive. gplink doesn't care about file extensions.
-   This allows alternate extensions such as .a archives and .obj coff objects. */
+/* Find a coff object or archive in the current directory or in the include paths. */
 
-void
-gplink_open_coff(const char *Name)
+static char *
+_find_coff(const char *Name)
 {
-  gp_object_t  *object;
-  gp_archive_t *archive;
-  FILE         *coff;
-  char         *full_name;
-  int           i;
-  int           len;
+  FILE *coff;
+  char *full_name;
+  int   i;
+  int   len;
 
   full_name = GP_Strdup(Name);
 
@@ -531,36 +771,164 @@ gplink_open_coff(const char *Name)
     exit(1);
   }
 
-  /* FIXME: Three files are opened, surely one is sufficent. */
+  fclose(coff);
+  return full_name;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Append a coff object or archive which has been read, or report why it could not be read. */
 
-  switch (gp_identify_coff_file(full_name)) {
+static void
+_append_coff(coff_file_t *File)
+{
+  gp_message_buffer_flush(&File->messages);
+
+  switch (File->type) {
     case GP_COFF_OBJECT_V2:
     case GP_COFF_OBJECT:
-      /* read the object */
-      object = gp_read_coff(full_name);
-      /*object_append(object, full_name);*/
-      _object_append(object);
+      _object_append(File->object);
       break;
 
     case GP_COFF_ARCHIVE:
-      /* read the archive */
-      archive = gp_archive_read(full_name);
-      _archive_append(archive, full_name);
+      _archive_append(File->archive, File->full_name);
       break;
 
     case GP_COFF_SYS_ERR:
-      gp_error("Can't open file \"%s\".", full_name);
+      gp_error("Can't open file \"%s\".", File->full_name);
       break;
 
     case GP_COFF_UNKNOWN:
-      gp_error("\"%s\" is not a valid coff object or archive.", full_name);
+      gp_error("\"%s\" is not a valid coff object or archive.", File->full_name);
       break;
 
     default:
       assert(0);
   }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_read_coff(size_t Index, void *Files)
+{
+  coff_file_t *file = &((coff_file_t *)Files)[Index];
+
+  switch (file->type) {
+    case GP_COFF_OBJECT_V2:
+    case GP_COFF_OBJECT:
+      file->object = gp_read_coff(file->full_name);
+      break;
+
+    case GP_COFF_ARCHIVE:
+      file->archive = gp_archive_read(file->full_name);
+      break;
+
+    default:
+      break;
+  }
+}
 
-  free(full_name);
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_read_coff_job(size_t Index, void *Files)
+{
+  coff_file_t *file = &((coff_file_t *)Files)[Index];
+
+  gp_message_buffer_begin(&file->messages);
+  _read_coff(Index, Files);
+  gp_message_buffer_end();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Show the reason of the protection for each section, which is not removed as dead section. */
+
+static void
+_show_kept_sections(void)
+{
+  const gp_section_t *section;
+
+  printf("Kept sections:\n");
+
+  section = state.object->section_list.first;
+  while (section != NULL) {
+    if (section->protected_by != NULL) {
+      printf("  \"%s\": referenced by \"%s\" through \"%s\"\n", section->name,
+             section->protected_by->name, section->protected_through->name);
+    }
+    else if (FlagIsSet(section->flags, STYP_ABS)) {
+      printf("  \"%s\": absolute section\n", section->name);
+    }
+    else if (FlagIsSet(section->flags, STYP_DATA)) {
+      printf("  \"%s\": initialized data section\n", section->name);
+    }
+    else {
+      /* Without the -O2 option the dead sections are kept too. */
+      printf("  \"%s\": not referenced\n", section->name);
+    }
+
+    section = section->next;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Read a coff object or archive. gplink doesn't care about file extensions.
+   This allows alternate extensions such as .a archives and .obj coff objects. */
+
+void
+gplink_open_coff(const char *Name)
+{
+  coff_file_t file;
+
+  memset(&file, 0, sizeof(file));
+  file.full_name = _find_coff(Name);
+  file.type      = gp_identify_coff_file(file.full_name);
+  _read_coff(0, &file);
+  _append_coff(&file);
+  free(file.full_name);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Read the objects and archives of the command line. The files are independent of each other,
+   so they are read on state.jobs threads, then they are appended in the order of the command
+   line, as if they had been read one by one. The messages of the reading are held back and
+   written before the append of their file. */
+
+static void
+_open_coff_files(char *Names[], size_t Num_names)
+{
+  coff_file_t *files;
+  size_t       i;
+
+  report_phase("read objects");
+  files = (coff_file_t *)GP_Calloc(Num_names, sizeof(coff_file_t));
+
+  for (i = 0; i < Num_names; ++i) {
+    files[i].full_name = _find_coff(Names[i]);
+    files[i].type      = gp_identify_coff_file(files[i].full_name);
+  }
+
+  if (state.jobs <= 1) {
+    for (i = 0; i < Num_names; ++i) {
+      _read_coff(i, files);
+      _append_coff(&files[i]);
+      free(files[i].full_name);
+    }
+  }
+  else {
+    gp_thread_run(state.jobs, Num_names, _read_coff_job, files);
+
+    for (i = 0; i < Num_names; ++i) {
+      _append_coff(&files[i]);
+      free(files[i].full_name);
+    }
+  }
+
+  free(files);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -608,6 +976,7 @@ _init(void)
   state.map_file             = OUT_SUPPRESS;
   state.obj_file             = OUT_SUPPRESS;
   state.strict_level         = 0;
+  state.jobs                 = 1;
 
   /* set default output filename to be a.o, a.hex, a.cod, a.map */
   strncpy(state.base_file_name, "a", sizeof(state.base_file_name));
@@ -788,6 +1157,19 @@ _process_args(int Argc, char *Argv[])
         break;
       }
 
+      case 'J': {
+        state.jobs = (unsigned int)strtoul(optarg, NULL, 10);
+        if ((state.jobs < 1) || (state.jobs > GP_THREAD_MAX)) {
+          gp_error("Invalid number of jobs: %s", optarg);
+          state.jobs = 1;
+        }
+        else if ((state.jobs > 1) && (!gp_thread_available())) {
+          gp_warning("Threads are not supported, the jobs are done one by one.");
+          state.jobs = 1;
+        }
+        break;
+      }
+
       case 'l': {
         state.lst_file = OUT_SUPPRESS;
         break;
@@ -896,11 +1278,24 @@ _process_args(int Argc, char *Argv[])
         break;
       }
 
+      case OPT_SHOW_KEPT_SECTIONS: {
+        show_kept_sections = true;
+        break;
+      }
+
       case OPT_MPLINK_COMPATIBLE: {
         state.mplink_compatible = true;
         break;
       }
 
+      case OPT_TIME_REPORT: {
+        if (!report_is_enabled()) {
+          report_enable(optarg);
+          atexit(report_write);
+        }
+        break;
+      }
+
 #ifdef GPUTILS_DEBUG
       case OPT_DUMP_COFF: {
         gp_dump_coff = true;
@@ -960,9 +1355,239 @@ _process_args(int Argc, char *Argv[])
   }
 
   /* Open all objects and archives in the file list. */
-  for ( ; optind < Argc; optind++) {
-    gplink_open_coff(Argv[optind]);
+  if (optind < Argc) {
+    _open_coff_files(&Argv[optind], (size_t)(Argc - optind));
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The outputs of the linker, in the order in which they were written one after another. The listing
+   drives the line records of the cod file, so these two are written together. */
+
+enum output_kind {
+  OUTPUT_COFF,
+  OUTPUT_HEX,
+  OUTPUT_COD_LST,
+  OUTPUT_MAP,
+  OUTPUT_NUM
+};
+
+static const char *output_names[OUTPUT_NUM] = {
+  "coff", "hex", "cod and lst", "map"
+};
+
+static const char *phase_names[OUTPUT_NUM] = {
+  "write coff", "write hex", "write cod and lst", "write map"
+};
+
+typedef struct output_context {
+  gp_message_buffer_t messages[OUTPUT_NUM];
+  gp_boolean          failed[OUTPUT_NUM];
+  gp_boolean          buffered;
+  int                 num_errors;
+} output_context_t;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_write_output(size_t Index, void *Context)
+{
+  output_context_t *context = (output_context_t *)Context;
+  double            start_time;
+  gp_boolean        ok;
+
+  start_time = report_wall_time();
+
+  if (context->buffered) {
+    gp_message_buffer_begin(&context->messages[Index]);
+  }
+
+  switch (Index) {
+    case OUTPUT_COFF:
+      if (state.obj_file == OUT_NORMAL) {
+        /* write the executable object in memory */
+        ok = gp_writeobj_write_coff(state.object, context->num_errors);
+      }
+      else {
+        unlink(state.object->filename);
+        ok = true;
+      }
+      break;
+
+    case OUTPUT_HEX:
+      ok = gp_writehex(state.base_file_name, state.i_memory, state.hex_format, context->num_errors, 0,
+                       state.class->core_mask);
+      break;
+
+    case OUTPUT_COD_LST:
+      /* convert the executable object into a cod file and list file */
+      ok = cod_init(context->num_errors);
+      ok = lst_write(context->num_errors) && ok;
+
+      if (!state.cod.no_save_local) {
+        _add_local_ram_symbols();
+      }
+
+      ok = cod_close_file() && ok;
+      break;
+
+    case OUTPUT_MAP:
+      ok = make_map(context->num_errors);
+      break;
+
+    default:
+      ok = true;
+  }
+
+  context->failed[Index] = !ok;
+
+  if (context->buffered) {
+    gp_message_buffer_end();
+  }
+
+  report_output(output_names[Index], start_time);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Remove the files of an output which must not stay after a failed object or hex file. */
+
+static void
+_remove_output(size_t Index)
+{
+  char name[BUFSIZ];
+
+  switch (Index) {
+    case OUTPUT_HEX:
+      snprintf(name, sizeof(name), "%s.hex", state.base_file_name);
+      unlink(name);
+      snprintf(name, sizeof(name), "%s.hxl", state.base_file_name);
+      unlink(name);
+      snprintf(name, sizeof(name), "%s.hxh", state.base_file_name);
+      unlink(name);
+      break;
+
+    case OUTPUT_COD_LST:
+      /* The writers have not named these files, if they did not run. */
+      if (state.cod_file != OUT_NAMED) {
+        snprintf(state.cod_file_name, sizeof(state.cod_file_name), "%s.cod", state.base_file_name);
+      }
+
+      if (state.lst_file != OUT_NAMED) {
+        snprintf(state.lst_file_name, sizeof(state.lst_file_name), "%s.lst", state.base_file_name);
+      }
+
+      unlink(state.cod_file_name);
+      unlink(state.lst_file_name);
+      break;
+
+    case OUTPUT_MAP:
+      unlink(state.map_file_name);
+      break;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Write the output files. On more threads all writers run at the same time, they only read the
+   final object; the symbol numbers of the COFF writer and the listed marks of the listing are
+   written, but the others do not read them. The messages are held back and written in the old
+   order.
+
+   If the object or the hex file fails, the outputs after it are removed and their messages are
+   dropped, as if they had not been written, at every number of threads. The cod and lst files
+   and the map do not depend on each other. */
+
+static void
+_write_outputs(void)
+{
+  output_context_t context;
+  size_t           last;
+  size_t           i;
+
+  memset(&context, 0, sizeof(context));
+  context.num_errors = gp_num_errors;
+  last = OUTPUT_NUM;
+
+  if (state.jobs <= 1) {
+    for (i = 0; i < OUTPUT_NUM; ++i) {
+      report_phase(phase_names[i]);
+      _write_output(i, &context);
+
+      if (context.failed[i] && (i <= OUTPUT_HEX)) {
+        last = i + 1;
+        break;
+      }
+    }
+  }
+  else {
+    /* The writers run at the same time, the outputs hold their own times. */
+    report_phase("write outputs");
+    context.buffered = true;
+    gp_thread_run(state.jobs, OUTPUT_NUM, _write_output, &context);
+
+    if (context.failed[OUTPUT_COFF]) {
+      last = OUTPUT_COFF + 1;
+    }
+    else if (context.failed[OUTPUT_HEX]) {
+      last = OUTPUT_HEX + 1;
+    }
+
+    for (i = 0; i < OUTPUT_NUM; ++i) {
+      if (i < last) {
+        gp_message_buffer_flush(&context.messages[i]);
+      }
+      else {
+        gp_message_buffer_discard(&context.messages[i]);
+      }
+    }
   }
+
+  for (i = last; i < OUTPUT_NUM; ++i) {
+    _remove_output(i);
+  }
+
+  if (context.failed[OUTPUT_COFF]) {
+    gp_error("Error while writing object file.");
+    exit(1);
+  }
+
+  if (context.failed[OUTPUT_HEX]) {
+    gp_error("Error while writing hex file.");
+    exit(1);
+  }
+
+  /* The writers have already told the reason of the failure. */
+  if (context.failed[OUTPUT_COD_LST] || context.failed[OUTPUT_MAP]) {
+    exit(1);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Counts the parts of the executable object for the time report. */
+
+static void
+_report_object_counts(const gp_object_t *Object)
+{
+  const gp_section_t *section;
+  size_t              num_relocations;
+  size_t              num_line_numbers;
+
+  num_relocations  = 0;
+  num_line_numbers = 0;
+  section = Object->section_list.first;
+  while (section != NULL) {
+    num_relocations  += section->relocation_list.num_nodes;
+    num_line_numbers += section->line_number_list.num_nodes;
+    section = section->next;
+  }
+
+  report_count("sections", Object->section_list.num_nodes);
+  report_count("symbols", Object->symbol_list.num_nodes);
+  report_count("relocations", num_relocations);
+  report_count("line_numbers", num_line_numbers);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -970,9 +1595,12 @@ _process_args(int Argc, char *Argv[])
 static gp_boolean
 _linker(void)
 {
-  MemBlock_t *data;
-  MemBlock_t *program;
-  srcfns_t   *p;
+  MemBlock_t  *data;
+  MemBlock_t  *program;
+  srcfns_t    *p;
+  gp_object_t *object;
+  size_t       num_objects;
+  size_t       num_sections;
 
   /* setup output filenames */
   snprintf(state.hex_file_name, sizeof(state.hex_file_name), "%s.hex", state.base_file_name);
@@ -980,6 +1608,7 @@ _linker(void)
   snprintf(state.obj_file_name, sizeof(state.obj_file_name), "%s.cof", state.base_file_name);
 
   /* Read the script. */
+  report_phase("read script");
   if (state.src_file_names != NULL) {
     p = state.src_file_names;
 
@@ -1029,9 +1658,17 @@ _linker(void)
 
   /* Construct the symbol tables. Determine which archive members are
      required to resolve external references. */
+  report_phase("build tables");
   _build_tables();
 
+  num_objects = 0;
+  for (object = state.object; object != NULL; object = object->next) {
+    ++num_objects;
+  }
+  report_count("objects", num_objects);
+
   /* combine all object files into one object */
+  report_phase("combine objects");
   gp_cofflink_combine_objects(state.object);
 
   /* add the stack section */
@@ -1051,17 +1688,27 @@ _linker(void)
   gp_coffgen_check_relocations(state.object, (enable_cinit_wanings) ? RELOC_ENABLE_CINIT_WARN : 0);
 
   if (state.optimize.dead_sections) {
+    report_phase("remove dead sections");
+    num_sections = state.object->section_list.num_nodes;
     gp_coffopt_remove_dead_sections(state.object, 0, enable_cinit_wanings);
+    report_count("dead_sections", num_sections - state.object->section_list.num_nodes);
+  }
+
+  if (show_kept_sections) {
+    _show_kept_sections();
   }
 
   /* combine overlay sections */
+  report_phase("merge overlay sections");
   gp_cofflink_combine_overlay(state.object, 0);
 
   /* combine all sections with the same name */
+  report_phase("merge sections");
   gp_cofflink_merge_sections(state.object);
   gp_symbol_make_hash_table(state.object);
 
   /* create ROM data for initialized data sections */
+  report_phase("make idata");
   gp_cofflink_make_idata(state.object, state.mplink_compatible);
 
   /* create memory representing target memory */
@@ -1070,9 +1717,11 @@ _linker(void)
 
   /* allocate memory for absolute sections */
   gp_debug("Verifying absolute sections.");
+  report_phase("reloc abs program");
   gp_cofflink_reloc_abs(state.object, program, state.class->org_to_byte_shift,
                         STYP_ROM_AREA);
 
+  report_phase("reloc abs data");
   gp_cofflink_reloc_abs(state.object, data, 0,
                         STYP_RAM_AREA | STYP_SHARED | STYP_OVERLAY | STYP_ACCESS);
 
@@ -1083,6 +1732,7 @@ _linker(void)
     cinit_section = gp_coffgen_find_section(state.object, state.object->section_list.first, ".cinit");
 
     if (cinit_section != NULL) {
+      report_phase("reloc cinit");
       gp_cofflink_reloc_cinit(state.object, program, state.class->org_to_byte_shift,
                               cinit_section, state.section.definition);
     }
@@ -1092,10 +1742,12 @@ _linker(void)
 
   /* allocate memory for relocatable assigned sections */
   gp_debug("Relocating assigned sections.");
+  report_phase("reloc assigned program");
   gp_cofflink_reloc_assigned(state.object, program, state.class->org_to_byte_shift,
                              STYP_ROM_AREA,
                              state.section.definition, state.section.logical);
 
+  report_phase("reloc assigned data");
   gp_cofflink_reloc_assigned(state.object, data, 0,
                              STYP_RAM_AREA | STYP_SHARED | STYP_OVERLAY | STYP_ACCESS,
                              state.section.definition, state.section.logical);
@@ -1104,17 +1756,21 @@ _linker(void)
 
   /* allocate memory for relocatable unassigned sections */
   gp_debug("Relocating unassigned sections.");
+  report_phase("reloc unassigned program");
   gp_cofflink_reloc_unassigned(state.object, program, state.class->org_to_byte_shift,
                                STYP_ROM_AREA, state.section.definition);
 
+  report_phase("reloc unassigned data");
   gp_cofflink_reloc_unassigned(state.object, data, 0,
                                STYP_RAM_AREA | STYP_SHARED | STYP_OVERLAY | STYP_ACCESS,
                                state.section.definition);
 
   /* load the table with the relocated addresses */
+  report_phase("update table");
   gp_cofflink_add_cinit_section(state.object);
 
   gp_cofflink_update_table(state.object, state.class->org_to_byte_shift);
+  report_count("searched_bytes", gp_cofflink_searched_bytes);
 
   /* remove unnecessary pcallw stubs (created by the SDCC compiler)
    *
@@ -1122,6 +1778,7 @@ _linker(void)
    * sections have been relocated.
    */
   if (state.optimize.experimental_pcallw) {
+    report_phase("pcallw");
     gp_coffopt_remove_unnecessary_pcallw_experimental(state.object);
   }
 
@@ -1131,6 +1788,8 @@ _linker(void)
 
   if (state.optimize.experimental_banksel || state.optimize.experimental_pagesel) {
     if (state.optimize.banksel > 0) {
+      report_phase("banksel");
+
       if (state.optimize.experimental_banksel) {
         gp_coffopt_remove_unnecessary_banksel_experimental(state.object);
       }
@@ -1140,6 +1799,8 @@ _linker(void)
     }
 
     if (state.optimize.pagesel > 0) {
+      report_phase("pagesel");
+
       if (state.optimize.experimental_pagesel) {
         gp_coffopt_remove_unnecessary_pagesel_experimental(state.object);
       }
@@ -1150,14 +1811,19 @@ _linker(void)
   }
   else {
     if (state.optimize.pagesel > 0) {
+      report_phase("pagesel");
       gp_coffopt_remove_unnecessary_pagesel(state.object);
     }
 
     if (state.optimize.banksel > 0) {
+      report_phase("banksel");
       gp_coffopt_remove_unnecessary_banksel(state.object);
     }
   }
 
+  report_count("removed_instructions", gp_coffopt_removed_insns);
+
+  report_phase("fill pages");
   gp_coffgen_make_linenum_array(state.object);
 
   gp_cofflink_fill_pages(state.object, program, state.section.definition);
@@ -1166,7 +1832,9 @@ _linker(void)
   gp_mem_i_free(program);
 
   /* patch raw data with the relocated symbol values */
-  gp_cofflink_patch(state.object, state.mplink_compatible);
+  _report_object_counts(state.object);
+  report_phase("patch");
+  gp_cofflink_patch(state.object, state.mplink_compatible, state.jobs);
 
   /* Modify the executable object name. */
   if (state.object->filename != NULL) {
@@ -1176,40 +1844,13 @@ _linker(void)
   state.object->filename  = GP_Strdup(state.obj_file_name);
   state.object->flags    |= F_EXEC;
 
-  if (state.obj_file == OUT_NORMAL) {
-    /* write the executable object in memory */
-    if (!gp_writeobj_write_coff(state.object, gp_num_errors)) {
-      gp_error("Error while writing object file.");
-      exit(1);
-    }
-  }
-  else {
-    unlink(state.object->filename);
-  }
-
   /* convert the executable object into a hex file */
+  report_phase("make memory");
   state.i_memory = gp_cofflink_make_memory(state.object);
 
-  /* write hex file */
-  if (!gp_writehex(state.base_file_name, state.i_memory, state.hex_format, gp_num_errors,
-                   0, state.class->core_mask)) {
-    gp_error("Error while writing hex file.");
-    exit(1);
-  }
-
-  /* convert the executable object into a cod file and list file */
-  cod_init();
-  lst_write();
-
-  if (!state.cod.no_save_local) {
-    _add_local_ram_symbols();
-  }
-
-  cod_close_file();
-
-  /* write map file */
-  make_map();
+  _write_outputs();
 
+  report_phase("free");
   gp_mem_i_free(state.i_memory);
   gp_coffgen_free_object(state.object);
 
@@ -149,27 +149,21 @@ _lst_line(const char *Format, ...)
 static const gp_linenum_t *
 _find_line_number(const gp_symbol_t *Symbol, unsigned int Line_number)
 {
-  const gp_section_t *section;
+  gp_section_t       *section;
   const gp_linenum_t *linenum;
 
-  section = state.object->section_list.first;
-  while (section != NULL) {
-    linenum = gp_coffgen_find_linenum(section, Symbol, Line_number);
+  section = NULL;
+  linenum = gp_coffgen_find_object_linenum(state.object, Symbol, Line_number, &section);
 
-    if (linenum != NULL) {
-      if (section != line_section) {
-        /* Switching sections, so update was_org with the new address. */
-        state.lst.was_byte_addr = linenum->address;
-        line_section            = section;
-      }
-
-      return linenum;
+  if (linenum != NULL) {
+    if (section != line_section) {
+      /* Switching sections, so update was_org with the new address. */
+      state.lst.was_byte_addr = linenum->address;
+      line_section            = section;
     }
-
-    section = section->next;
   }
 
-  return NULL;
+  return linenum;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -341,14 +335,14 @@ _write_source(int Last_line)
  * _lst_init - initialize the lst file
  */
 
-static void
-_lst_init(void)
+static gp_boolean
+_lst_init(int Num_errors)
 {
   if (state.lst_file != OUT_NAMED) {
     snprintf(state.lst_file_name, sizeof(state.lst_file_name), "%s.lst", state.base_file_name);
   }
 
-  if ((gp_num_errors > 0) || (state.lst_file == OUT_SUPPRESS)) {
+  if ((Num_errors > 0) || (state.lst_file == OUT_SUPPRESS)) {
     state.lst.f       = NULL;
     state.lst.enabled = false;
     unlink(state.lst_file_name);
@@ -357,14 +351,15 @@ _lst_init(void)
     state.lst.f = fopen(state.lst_file_name, "wt");
 
     if (state.lst.f == NULL) {
-      perror(state.lst_file_name);
-      exit(1);
+      gp_error("%s: %s", state.lst_file_name, strerror(errno));
+      state.lst.enabled = false;
+      return false;
     }
     state.lst.enabled = true;
   }
 
   if (!state.lst.enabled) {
-    return;
+    return true;
   }
 
   state.lst.was_byte_addr = 0;
@@ -377,21 +372,24 @@ _lst_init(void)
   _lst_line("");
   _lst_line("Address  Value    Disassembly              Source");
   _lst_line("-------  -----    -----------              ------");
+  return true;
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
-lst_write(void)
+gp_boolean
+lst_write(int Num_errors)
 {
   gp_symbol_t    *symbol;
   const gp_aux_t *aux;
   gp_boolean      first_time;
 
-  _lst_init();
+  if (!_lst_init(Num_errors)) {
+    return false;
+  }
 
   if (!state.lst.enabled) {
-    return;
+    return true;
   }
 
   symbol        = state.object->symbol_list.first;
@@ -454,4 +452,5 @@ lst_write(void)
   }
 
   fclose(state.lst.f);
+  return true;
 }
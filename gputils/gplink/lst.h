@@ -24,6 +24,6 @@ Boston, MA 02111-1307, USA.  */
 #ifndef __LST_H__
 #define __LST_H__
 
-extern void lst_write(void);
+extern gp_boolean lst_write(int Num_errors);
 
 #endif
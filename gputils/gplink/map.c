@@ -374,18 +374,18 @@ _write_symbols(void)
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
-make_map(void)
+gp_boolean
+make_map(int Num_errors)
 {
-  if ((gp_num_errors > 0) || (state.map_file == OUT_SUPPRESS)) {
+  if ((Num_errors > 0) || (state.map_file == OUT_SUPPRESS)) {
     unlink(state.map_file_name);
-    return;
+    return true;
   }
 
   state.map.f = fopen(state.map_file_name, "wt");
   if (state.map.f == NULL) {
-    perror(state.map_file_name);
-    exit(1);
+    gp_error("%s: %s", state.map_file_name, strerror(errno));
+    return false;
   }
 
   _map_line("%s", GPLINK_VERSION_STRING);
@@ -402,4 +402,5 @@ make_map(void)
   _write_symbols();
 
   fclose(state.map.f);
+  return true;
 }
@@ -24,6 +24,6 @@ Boston, MA 02111-1307, USA.  */
 #ifndef MAP_H
 #define MAP_H
 
-extern void make_map(void);
+extern gp_boolean make_map(int Num_errors);
 
 #endif
@@ -0,0 +1,328 @@
+/* Time and memory report of the linker
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#include "stdhdr.h"
+
+#include <time.h>
+
+#if defined(HAVE_SYS_TIME_H) && defined(HAVE_GETTIMEOFDAY)
+  #include <sys/time.h>
+  #define USE_GETTIMEOFDAY
+#endif
+
+#if defined(HAVE_SYS_RESOURCE_H) && defined(HAVE_GETRUSAGE)
+  #include <sys/resource.h>
+  #define USE_GETRUSAGE
+#endif
+
+#include "libgputils.h"
+#include "report.h"
+
+#define MAX_PHASES                      32
+#define MAX_OUTPUTS                     8
+#define MAX_COUNTERS                    16
+
+/* The phases follow one another, a phase ends where the next one begins. The outputs are timed
+   one by one because they may be written at the same time on several threads. */
+
+typedef struct report_phase {
+  const char *name;
+  double      wall;
+  double      cpu;
+  long        rss_delta;                /* The growth of the peak resident set size (kB). */
+} report_phase_t;
+
+typedef struct report_item {
+  const char *name;
+  double      wall;
+  size_t      value;
+} report_item_t;
+
+static gp_boolean     enabled = false;
+static const char    *json_file_name;
+
+static report_phase_t phases[MAX_PHASES];
+static size_t         num_phases;
+static report_item_t  outputs[MAX_OUTPUTS];
+static size_t         num_outputs;
+static report_item_t  counters[MAX_COUNTERS];
+static size_t         num_counters;
+
+static double         start_wall;
+static double         start_cpu;
+
+static double         phase_wall;
+static double         phase_cpu;
+static long           phase_rss;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static double
+_cpu_time(void)
+{
+  return ((double)clock() / CLOCKS_PER_SEC);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The peak resident set size of the process in kB, or zero if it is not known. */
+
+static long
+_peak_rss(void)
+{
+#ifdef USE_GETRUSAGE
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    return usage.ru_maxrss;
+  }
+#endif
+  return 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Closes the current phase, if there is one. */
+
+static void
+_phase_end(void)
+{
+  report_phase_t *phase;
+
+  if (num_phases == 0) {
+    return;
+  }
+
+  phase = &phases[num_phases - 1];
+  phase->wall      = report_wall_time() - phase_wall;
+  phase->cpu       = _cpu_time() - phase_cpu;
+  phase->rss_delta = _peak_rss() - phase_rss;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_write_table(FILE *Out)
+{
+  size_t i;
+
+  fprintf(Out, "\nLinker time report:\n");
+  fprintf(Out, "  %-24s %10s %10s %14s\n", "phase", "wall (s)", "cpu (s)", "peak rss (kB)");
+
+  for (i = 0; i < num_phases; ++i) {
+    fprintf(Out, "  %-24s %10.4f %10.4f %+14ld\n", phases[i].name, phases[i].wall, phases[i].cpu,
+            phases[i].rss_delta);
+  }
+
+  fprintf(Out, "  %-24s %10.4f %10.4f %14ld\n", "total", report_wall_time() - start_wall,
+          _cpu_time() - start_cpu, _peak_rss());
+
+  if (num_outputs > 0) {
+    fprintf(Out, "\n  %-24s %10s\n", "output", "wall (s)");
+
+    for (i = 0; i < num_outputs; ++i) {
+      fprintf(Out, "  %-24s %10.4f\n", outputs[i].name, outputs[i].wall);
+    }
+  }
+
+  if (num_counters > 0) {
+    fprintf(Out, "\n  %-24s %10s\n", "counter", "value");
+
+    for (i = 0; i < num_counters; ++i) {
+      fprintf(Out, "  %-24s %10" SIZE_FMTu "\n", counters[i].name, counters[i].value);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The names are fixed strings of the linker, they need no escapes. */
+
+static void
+_write_json(FILE *Out)
+{
+  size_t i;
+
+  fprintf(Out, "{\n  \"version\": \"%s\",\n", VERSION);
+
+  fprintf(Out, "  \"phases\": [");
+  for (i = 0; i < num_phases; ++i) {
+    fprintf(Out, "%s\n    { \"name\": \"%s\", \"wall\": %.6f, \"cpu\": %.6f, \"peak_rss_delta_kb\": %ld }",
+            (i > 0) ? "," : "", phases[i].name, phases[i].wall, phases[i].cpu, phases[i].rss_delta);
+  }
+  fprintf(Out, "\n  ],\n");
+
+  fprintf(Out, "  \"outputs\": [");
+  for (i = 0; i < num_outputs; ++i) {
+    fprintf(Out, "%s\n    { \"name\": \"%s\", \"wall\": %.6f }",
+            (i > 0) ? "," : "", outputs[i].name, outputs[i].wall);
+  }
+  fprintf(Out, "\n  ],\n");
+
+  fprintf(Out, "  \"counters\": {");
+  for (i = 0; i < num_counters; ++i) {
+    fprintf(Out, "%s\n    \"%s\": %" SIZE_FMTu, (i > 0) ? "," : "", counters[i].name, counters[i].value);
+  }
+  fprintf(Out, "\n  },\n");
+
+  fprintf(Out, "  \"total\": { \"wall\": %.6f, \"cpu\": %.6f, \"peak_rss_kb\": %ld }\n}\n",
+          report_wall_time() - start_wall, _cpu_time() - start_cpu, _peak_rss());
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Starts the report. Without file name the report is a table on stderr, otherwise a JSON file. */
+
+void
+report_enable(const char *File_name)
+{
+  enabled        = true;
+  json_file_name = File_name;
+  start_wall     = report_wall_time();
+  start_cpu      = _cpu_time();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+gp_boolean
+report_is_enabled(void)
+{
+  return enabled;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The wall clock time in seconds. */
+
+double
+report_wall_time(void)
+{
+#ifdef USE_GETTIMEOFDAY
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return ((double)tv.tv_sec + (double)tv.tv_usec / 1000000.0);
+#else
+  return (double)time(NULL);
+#endif
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Ends the current phase and begins the next one. */
+
+void
+report_phase(const char *Name)
+{
+  if (!enabled) {
+    return;
+  }
+
+  _phase_end();
+
+  assert(num_phases < MAX_PHASES);
+  phases[num_phases].name = Name;
+  ++num_phases;
+
+  phase_wall = report_wall_time();
+  phase_cpu  = _cpu_time();
+  phase_rss  = _peak_rss();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Records the wall time of an output file. It may be called on the worker threads. */
+
+void
+report_output(const char *Name, double Start_time)
+{
+  double wall;
+
+  if (!enabled) {
+    return;
+  }
+
+  wall = report_wall_time() - Start_time;
+
+  gp_thread_lock();
+  assert(num_outputs < MAX_OUTPUTS);
+  outputs[num_outputs].name = Name;
+  outputs[num_outputs].wall = wall;
+  ++num_outputs;
+  gp_thread_unlock();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Sets a counter, a second call with the same name overwrites the value. */
+
+void
+report_count(const char *Name, size_t Value)
+{
+  size_t i;
+
+  if (!enabled) {
+    return;
+  }
+
+  for (i = 0; i < num_counters; ++i) {
+    if (strcmp(counters[i].name, Name) == 0) {
+      counters[i].value = Value;
+      return;
+    }
+  }
+
+  assert(num_counters < MAX_COUNTERS);
+  counters[num_counters].name  = Name;
+  counters[num_counters].value = Value;
+  ++num_counters;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Ends the last phase and writes the report. It is called at the exit of the linker. */
+
+void
+report_write(void)
+{
+  FILE *out;
+
+  if (!enabled) {
+    return;
+  }
+
+  _phase_end();
+  enabled = false;
+
+  if (json_file_name == NULL) {
+    _write_table(stderr);
+    return;
+  }
+
+  out = fopen(json_file_name, "wt");
+
+  if (out == NULL) {
+    perror(json_file_name);
+    return;
+  }
+
+  _write_json(out);
+  fclose(out);
+}
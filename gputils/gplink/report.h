@@ -0,0 +1,32 @@
+/* Time and memory report of the linker
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#ifndef REPORT_H
+#define REPORT_H
+
+extern void report_enable(const char *File_name);
+extern gp_boolean report_is_enabled(void);
+extern double report_wall_time(void);
+extern void report_phase(const char *Name);
+extern void report_output(const char *Name, double Start_time);
+extern void report_count(const char *Name, size_t Value);
+extern void report_write(void);
+
+#endif
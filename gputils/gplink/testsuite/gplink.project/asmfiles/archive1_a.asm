@@ -0,0 +1,13 @@
+
+	processor 16f877a
+
+	global	func_A
+	extern	func_D
+
+code_archive1_a	code
+func_A:
+	pagesel	func_D
+	call	func_D
+	retlw	0x11
+
+	end
@@ -0,0 +1,13 @@
+
+	processor 16f877a
+
+	global	func_A
+	global	func_B
+
+code_archive2_ab	code
+func_A:
+	retlw	0x21
+func_B:
+	retlw	0x22
+
+	end
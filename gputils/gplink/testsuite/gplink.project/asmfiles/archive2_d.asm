@@ -0,0 +1,10 @@
+
+	processor 16f877a
+
+	global	func_D
+
+code_archive2_d	code
+func_D:
+	retlw	0x24
+
+	end
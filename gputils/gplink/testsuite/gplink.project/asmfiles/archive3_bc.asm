@@ -0,0 +1,13 @@
+
+	processor 16f877a
+
+	global	func_B
+	global	func_C
+
+code_archive3_bc	code
+func_B:
+	retlw	0x32
+func_C:
+	retlw	0x33
+
+	end
@@ -0,0 +1,13 @@
+
+	processor 16f877a
+
+	global	func_C
+	global	func_D
+
+code_archive4_cd	code
+func_C:
+	retlw	0x43
+func_D:
+	retlw	0x44
+
+	end
@@ -0,0 +1,24 @@
+
+	processor 16f877a
+
+	extern	func_A
+	extern	func_B
+	extern	func_C
+
+code_reset	code	0x0000
+	pagesel	main
+	goto	main
+
+code_main	code
+main:
+	pagesel	func_A
+	call	func_A
+	pagesel	func_B
+	call	func_B
+	pagesel	func_C
+	call	func_C
+lock:
+	pagesel	lock
+	goto	lock
+
+	END
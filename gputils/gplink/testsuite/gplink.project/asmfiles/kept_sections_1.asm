@@ -0,0 +1,21 @@
+
+	processor 16f877a
+
+	extern	chain_A
+	extern	table
+
+code_reset	code	0x0000
+	pagesel	main
+	goto	main
+
+code_main	code
+main:
+	pagesel	chain_A
+	call	chain_A
+	banksel	table
+	movf	table, W
+lock:
+	pagesel	lock
+	goto	lock
+
+	END
@@ -0,0 +1,35 @@
+
+	processor 16f877a
+
+	global	chain_A
+	global	chain_B
+	global	chain_C
+	global	table
+	global	unused_A
+
+idata_table	idata
+table:
+	db	0x01, 0x02
+
+code_chain_A	code
+chain_A:
+	pagesel	chain_B
+	call	chain_B
+	return
+
+code_chain_B	code
+chain_B:
+	pagesel	chain_C
+	goto	chain_C
+
+code_chain_C	code
+chain_C:
+	retlw	0x12
+
+code_unused_A	code
+unused_A:
+	pagesel	chain_C
+	call	chain_C
+	retlw	0x34
+
+	end
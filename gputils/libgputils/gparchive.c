@@ -131,11 +131,8 @@ gp_archive_find_member(gp_archive_t *Archive, const char *Object_name)
 void
 gp_archive_free_member(gp_archive_t *Archive)
 {
-  if (Archive->data.file != NULL) {
-    free(Archive->data.file);
-  }
-
   if (Archive != NULL) {
+    gp_release_file(&Archive->data);
     free(Archive);
   }
 }
@@ -291,6 +288,24 @@ gp_archive_extract_member(gp_archive_t *Archive, const char *Object_name)
 
 /*------------------------------------------------------------------------------------------------*/
 
+static void
+_detach_members(gp_archive_t *Archive)
+{
+  uint8_t *copy;
+
+  while (Archive != NULL) {
+    if (Archive->data.storage == GP_BINARY_VIEW) {
+      copy = (uint8_t *)GP_Malloc(Archive->data.size);
+      memcpy(copy, Archive->data.file, (size_t)Archive->data.size);
+      Archive->data.file    = copy;
+      Archive->data.storage = GP_BINARY_BUFFER;
+    }
+    Archive = Archive->next;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 gp_boolean
 gp_archive_write(gp_archive_t *Archive, const char *Archive_name)
 {
@@ -299,6 +314,10 @@ gp_archive_write(gp_archive_t *Archive, const char *Archive_name)
 
   assert(Archive != NULL);
 
+  /* The members read from an archive are views into its mapping. The archive
+     may be written over itself, so copy them before the file is truncated. */
+  _detach_members(Archive);
+
   output_file = fopen(Archive_name, "wb");
   if (output_file == NULL) {
     perror(Archive_name);
@@ -339,51 +358,58 @@ gp_archive_update_offsets(gp_archive_t *Archive)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Read a coff archive and store it in memory. */
+/* Read a coff archive and store it in memory. The archive file is read (mapped
+   if possible) in one piece and the members are views into it, so it is kept
+   until the end of the program. */
 
 gp_archive_t *
 gp_archive_read(const char *File_name)
 {
-  FILE         *infile;
+  gp_binary_t  *image;
   gp_archive_t *archive;
   gp_archive_t *list;
   gp_archive_t *new;
-  ar_hdr_t      tmp_header;
-  fpos_t        position;
+  off_t         position;
   int           object_size;
-  char          buffer[SARMAG + 1];
 
-  infile = fopen(File_name, "rb");
-  if (infile == NULL) {
-    perror(File_name);
-    exit(1);
-  }
+  image = gp_read_file(File_name);
 
   /* read the magic number */
-  if ((fread(buffer, 1, SARMAG, infile) != SARMAG) || (strncmp(buffer, ARMAG, SARMAG) != 0)) {
-    fclose(infile);
+  if ((image->size < SARMAG) || (strncmp((const char *)image->file, ARMAG, SARMAG) != 0)) {
+    gp_free_file(image);
     return NULL;
   }
 
-  archive = NULL;
-  while (feof(infile) == 0) {
+  archive  = NULL;
+  position = SARMAG;
+  while (true) {
+    /* read the archive header */
+    if ((image->size - position) < AR_HDR_SIZ) {
+      gp_error("bad archive \"%s\"", File_name);
+      break;
+    }
+
     /* allocate space for the next archive member */
     new = (gp_archive_t *)GP_Malloc(sizeof(gp_archive_t));
     new->next = NULL;
 
-    /* read the archive header */
-    if (fread(&new->header, 1, AR_HDR_SIZ, infile) != AR_HDR_SIZ) {
-      gp_error("bad archive \"%s\"", File_name);
-    }
+    memcpy(&new->header, &image->file[position], AR_HDR_SIZ);
+    position += AR_HDR_SIZ;
 
-    /* read the object file or symbol index into memory */
+    /* point to the object file or symbol index */
+    object_size = 0;
     sscanf(new->header.ar_size, "%il", &object_size);
-    new->data.size = object_size;
-    new->data.file = (uint8_t *)GP_Malloc(object_size);
-    if (fread(new->data.file, sizeof(char), object_size, infile) != object_size) {
+    if ((object_size < 0) || (object_size > (image->size - position))) {
       gp_error("bad archive \"%s\"", File_name);
+      free(new);
+      break;
     }
 
+    new->data.size    = object_size;
+    new->data.file    = &image->file[position];
+    new->data.storage = GP_BINARY_VIEW;
+    position += object_size;
+
     /* insert the new member in the archive list */
     if (archive == NULL) {
       /* this is the first entry */
@@ -395,19 +421,15 @@ gp_archive_read(const char *File_name)
 
     list = new;
 
-    /* Some malformed libs have a couple of extra bytes on the end. The while eof
-       test passes, but there are no other members. Test for it. */
-    fgetpos(infile, &position);
-    if (fread(&tmp_header, 1, AR_HDR_SIZ, infile) != AR_HDR_SIZ) {
+    /* Some malformed libs have a couple of extra bytes on the end. There are no
+       other members if a complete header does not fit. */
+    if ((image->size - position) < AR_HDR_SIZ) {
       break;
     }
-    fsetpos(infile, &position);
   }
 
   gp_archive_update_offsets(archive);
 
-  fclose(infile);
-
   return archive;
 }
 
@@ -465,7 +487,8 @@ gp_archive_make_index(gp_archive_t *Archive, symbol_table_t *Definition)
       *end = '\0';
     }
 
-    object = gp_convert_file(name, &Archive->data);
+    /* Only the symbols are needed. */
+    object = gp_convert_file_symbols(name, &Archive->data);
     assert(object != NULL);
     gp_cofflink_add_symbols(Definition, NULL, object);
     Archive = Archive->next;
@@ -513,9 +536,10 @@ gp_archive_add_index(symbol_table_t *Table, gp_archive_t *Archive)
 
   /* create a new member for the index and place it in the archive */
   new_member = (gp_archive_t *)GP_Malloc(sizeof(*new_member));
-  new_member->data.file = (uint8_t *)GP_Malloc(index_size);
-  new_member->data.size = index_size;
-  new_member->next      = NULL;
+  new_member->data.file    = (uint8_t *)GP_Malloc(index_size);
+  new_member->data.size    = index_size;
+  new_member->data.storage = GP_BINARY_BUFFER;
+  new_member->next         = NULL;
 
   /* fill in the archive header */
   memset(&new_member->header, ' ', AR_HDR_SIZ); /* fill the header with space */
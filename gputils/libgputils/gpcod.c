@@ -419,7 +419,7 @@ gp_cod_enumerate_directory(DirBlockInfo *Main_dir)
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
+gp_boolean
 gp_cod_block_write(FILE *F, const Blocks *Bl)
 {
   const BlockList *curr;
@@ -428,16 +428,19 @@ gp_cod_block_write(FILE *F, const Blocks *Bl)
   /* write block list */
   while (curr != NULL) {
     if (fwrite(curr->block, 1, COD_BLOCK_SIZE, F) != COD_BLOCK_SIZE) {
-      fprintf(stderr, "%s() -- Could not write cod file.\n", __func__);
-      exit(1);
+      return false;
     }
     curr = curr->next;
   }
+
+  return true;
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-void
+/* Write the blocks of the directory, return false if the file could not be written. */
+
+gp_boolean
 gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir)
 {
   const DirBlockInfo *dbi;
@@ -446,8 +449,7 @@ gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir)
   /* write directory blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
     if (fwrite(dbi->dir, 1, COD_BLOCK_SIZE, F) != COD_BLOCK_SIZE) {
-      fprintf(stderr, "%s() -- Could not write cod file.\n", __func__);
-      exit(1);
+      return false;
     }
   }
 
@@ -456,8 +458,7 @@ gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir)
     for (i = 0; i < COD_CODE_IMAGE_BLOCKS; ++i) {
       if (dbi->cod_image_blocks[i].block != NULL) {
         if (fwrite(dbi->cod_image_blocks[i].block, 1, COD_BLOCK_SIZE, F) != COD_BLOCK_SIZE) {
-          fprintf(stderr, "%s() -- Could not write cod file.\n", __func__);
-          exit(1);
+          return false;
         }
       }
     }
@@ -465,28 +466,40 @@ gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir)
 
   /* write source files blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
-    gp_cod_block_write(F, &dbi->file);
+    if (!gp_cod_block_write(F, &dbi->file)) {
+      return false;
+    }
   }
 
   /* write list lines blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
-    gp_cod_block_write(F, &dbi->list);
+    if (!gp_cod_block_write(F, &dbi->list)) {
+      return false;
+    }
   }
 
   /* write memory map blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
-    gp_cod_block_write(F, &dbi->range);
+    if (!gp_cod_block_write(F, &dbi->range)) {
+      return false;
+    }
   }
 
   /* write long symbol table blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
-    gp_cod_block_write(F, &dbi->lsym);
+    if (!gp_cod_block_write(F, &dbi->lsym)) {
+      return false;
+    }
   }
 
   /* write debug messages table blocks */
   for (dbi = Main_dir; dbi != NULL; dbi = dbi->next) {
-    gp_cod_block_write(F, &dbi->debug);
+    if (!gp_cod_block_write(F, &dbi->debug)) {
+      return false;
+    }
   }
+
+  return true;
 }
 
 /*------------------------------------------------------------------------------------------------*/
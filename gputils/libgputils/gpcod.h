@@ -304,8 +304,8 @@ extern BlockList *gp_cod_block_get_last_or_new(Blocks *Bl);
 extern int gp_cod_block_count(const Blocks *Bl);
 extern void gp_cod_block_enumerate(DirBlockInfo *Dir, unsigned int Offset, Blocks *Bl, unsigned int *Block_num);
 extern void gp_cod_enumerate_directory(DirBlockInfo *Main_dir);
-extern void gp_cod_block_write(FILE *F, const Blocks *Bl);
-extern void gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir);
+extern gp_boolean gp_cod_block_write(FILE *F, const Blocks *Bl);
+extern gp_boolean gp_cod_write_directory(FILE *F, const DirBlockInfo *Main_dir);
 extern void gp_cod_block_free(Blocks *Bl);
 extern void gp_cod_free_directory(DirBlockInfo *Main_dir);
 
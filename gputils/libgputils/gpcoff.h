@@ -575,6 +575,9 @@ typedef struct gp_aux_list {
 /* A optimize constant for the gpsymbol.c module. */
 #define OPT_FLAGS_GPSYMBOL_MODULE       (1 << 2)
 
+/* A optimize constant for the gpcofflink.c module. */
+#define OPT_FLAGS_GPCOFFLINK_MODULE     (1 << 5)
+
 /* This is a non-erasable section. */
 #define OPT_FLAGS_PROTECTED_SECTION     (1 << 16)
 
@@ -688,7 +691,14 @@ typedef struct gp_section {
 
   /* Ordered, filtered array unto binary searches. */
   gp_linenum_t      **line_numbers_array;
-  uint16_t            line_numbers_array_length;
+  unsigned int        line_numbers_array_length;
+
+  /* The line numbers ordered by address, built by the first lookup by address. */
+  gp_linenum_t      **linenum_address_array;
+  unsigned int        linenum_address_array_length;
+
+  /* The line number index of the owner object which covers this section. */
+  struct gp_linenum_index *linenum_index;
 
   /* section number, only valid when writing coff file */
   uint32_t            number;
@@ -725,6 +735,16 @@ typedef struct gp_section {
 
   /* use the optimization -- "OPT_FLAGS_..." */
   uint32_t           opt_flags;
+
+  /* The protected section and its symbol, which are referenced by a relocation
+     of this section. NULL if the section is protected by itself or not at all. */
+  const struct gp_section *protected_by;
+  const gp_symbol_t       *protected_through;
+
+  /* The next section with the same name and the place of this section in the
+     section list, only valid while the object has a section index. */
+  struct gp_section       *name_next;
+  unsigned int             name_pos;
 } gp_section_t;
 
 typedef struct gp_section_list {
@@ -788,6 +808,14 @@ typedef struct gp_object {
   gp_hash_t         *symbol_hashtable;
   unsigned int       symbol_hashtable_size;
 
+  /* Index of the section list by name, built by the first gp_coffgen_find_section() call. */
+  struct symbol_table *section_index;
+  unsigned int       section_index_pos;
+
+  /* Index of the line numbers of all sections by source file and line number,
+     built by the first gp_coffgen_find_object_linenum() call. */
+  struct gp_linenum_index *linenum_index;
+
   /* symbol table pointer, only valid when writing coff file */
   uint32_t           symbol_ptr;
 
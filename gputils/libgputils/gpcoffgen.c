@@ -24,9 +24,6 @@ Boston, MA 02111-1307, USA.  */
 #include "stdhdr.h"
 #include "libgputils.h"
 
-#define CHECK_RELOCATIONS_PASS_MAX      20
-#define CHECK_RELOCATIONS_DEPTH_MAX     100
-
 static unsigned int object_serial_id  = 0;
 static unsigned int section_serial_id = 0;
 
@@ -45,7 +42,9 @@ gp_coffgen_new_object(const char *File_name)
   object->processor = gp_find_processor("generic");
   object->class     = PROC_CLASS_GENERIC;
   object->time      = (uint32_t)time(NULL);
+  gp_thread_lock();
   object->serial_id = object_serial_id++;
+  gp_thread_unlock();
 
   gp_list_set_delete_node_func(&object->section_list, (gp_node_del_t)gp_coffgen_free_section);
   gp_list_set_delete_node_func(&object->dead_section_list, (gp_node_del_t)gp_coffgen_free_section);
@@ -58,6 +57,65 @@ gp_coffgen_new_object(const char *File_name)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Drop the section index of an object. */
+
+static void
+_section_index_clear(gp_object_t *Object)
+{
+  if (Object->section_index != NULL) {
+    gp_sym_pop_table(Object->section_index);
+    Object->section_index = NULL;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* One source line of an object and the first section, in list order, which contains it. */
+
+typedef struct linenum_key {
+  const gp_symbol_t *symbol;
+  unsigned int       line_number;
+  gp_section_t      *section;
+  unsigned int       section_pos;
+} linenum_key_t;
+
+typedef struct gp_linenum_index {
+  linenum_key_t *keys;
+  unsigned int   num_keys;
+
+  /* Cleared when the line numbers of a covered section change. */
+  gp_boolean     valid;
+} gp_linenum_index_t;
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Drop the line number index of an object. */
+
+static void
+_linenum_index_clear(gp_object_t *Object)
+{
+  gp_section_t *section;
+
+  if (Object->linenum_index == NULL) {
+    return;
+  }
+
+  section = Object->section_list.first;
+  while (section != NULL) {
+    section->linenum_index = NULL;
+    section = section->next;
+  }
+
+  if (Object->linenum_index->keys != NULL) {
+    free(Object->linenum_index->keys);
+  }
+
+  free(Object->linenum_index);
+  Object->linenum_index = NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Move linked lists between two object. */
 
 void
@@ -67,6 +125,10 @@ gp_coffgen_transfer_object_data(gp_object_t *Receiver, gp_object_t *Sender)
     return;
   }
 
+  _section_index_clear(Receiver);
+  _section_index_clear(Sender);
+  _linenum_index_clear(Receiver);
+  _linenum_index_clear(Sender);
   gp_list_move(&Receiver->section_list, &Sender->section_list);
   gp_list_move(&Receiver->dead_section_list, &Sender->dead_section_list);
   gp_list_move(&Receiver->symbol_list, &Sender->symbol_list);
@@ -121,26 +183,138 @@ gp_coffgen_update_all_object_id(gp_object_t *Object)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Build the section index of an object. The sections of the same name are chained in the order
+   of the section list, so the list is walked backward. */
+
+static void
+_section_index_build(gp_object_t *Object)
+{
+  gp_section_t *section;
+  symbol_t     *sym;
+  unsigned int  pos;
+
+  Object->section_index = gp_sym_push_arena_table(NULL, false);
+
+  pos     = Object->section_list.num_nodes;
+  section = Object->section_list.last;
+  while (section != NULL) {
+    section->name_pos  = --pos;
+    section->name_next = NULL;
+
+    if (section->name != NULL) {
+      sym                = gp_sym_add_symbol(Object->section_index, section->name);
+      section->name_next = (gp_section_t *)gp_sym_get_symbol_annotation(sym);
+      gp_sym_annotate_symbol(sym, section);
+    }
+
+    section = section->prev;
+  }
+
+  Object->section_index_pos = Object->section_list.num_nodes;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Add a section to the section index of an object. The section is the last one of the list. */
+
+static void
+_section_index_append(gp_object_t *Object, gp_section_t *Section)
+{
+  symbol_t     *sym;
+  gp_section_t *last;
+
+  if (Object->section_index == NULL) {
+    return;
+  }
+
+  Section->name_pos  = Object->section_index_pos++;
+  Section->name_next = NULL;
+
+  if (Section->name == NULL) {
+    return;
+  }
+
+  sym  = gp_sym_add_symbol(Object->section_index, Section->name);
+  last = (gp_section_t *)gp_sym_get_symbol_annotation(sym);
+
+  if (last == NULL) {
+    gp_sym_annotate_symbol(sym, Section);
+  }
+  else {
+    while (last->name_next != NULL) {
+      last = last->name_next;
+    }
+    last->name_next = Section;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Remove a section from the section index of an object. */
+
+static void
+_section_index_remove(gp_object_t *Object, gp_section_t *Section)
+{
+  symbol_t     *sym;
+  gp_section_t *prev;
+
+  if ((Object->section_index == NULL) || (Section->name == NULL)) {
+    return;
+  }
+
+  sym = gp_sym_get_symbol(Object->section_index, Section->name);
+  assert(sym != NULL);
+
+  prev = (gp_section_t *)gp_sym_get_symbol_annotation(sym);
+  if (prev == Section) {
+    if (Section->name_next != NULL) {
+      gp_sym_annotate_symbol(sym, Section->name_next);
+    }
+    else {
+      gp_sym_remove_symbol(Object->section_index, Section->name);
+    }
+  }
+  else {
+    while (prev->name_next != Section) {
+      prev = prev->name_next;
+      assert(prev != NULL);
+    }
+    prev->name_next = Section->name_next;
+  }
+
+  Section->name_next = NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Find a "Name" section from the given starting section. */
 
 gp_section_t *
 gp_coffgen_find_section(gp_object_t *Object, gp_section_t *Start, const char *Name)
 {
-  gp_section_t *section;
+  const symbol_t *sym;
+  gp_section_t   *section;
 
   if ((Object == NULL) || (Start == NULL)) {
     return NULL;
   }
 
-  section = Start;
-  while (section != NULL) {
-    if ((section->name != NULL) && (strcmp(section->name, Name) == 0)) {
-      return section;
-    }
-    section = section->next;
+  if (Object->section_index == NULL) {
+    _section_index_build(Object);
   }
 
-  return NULL;
+  sym = gp_sym_get_symbol(Object->section_index, Name);
+  if (sym == NULL) {
+    return NULL;
+  }
+
+  /* The first one which is not before the starting section. */
+  section = (gp_section_t *)gp_sym_get_symbol_annotation(sym);
+  while ((section != NULL) && (section->name_pos < Start->name_pos)) {
+    section = section->name_next;
+  }
+
+  return section;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -158,7 +332,9 @@ gp_coffgen_new_section(const char *Name, MemBlock_t *Data)
   /* initialize section */
   new->name      = GP_Strdup(Name);
   new->data      = (Data != NULL) ? Data : gp_mem_i_create();
+  gp_thread_lock();
   new->serial_id = section_serial_id++;
+  gp_thread_unlock();
 
   return new;
 }
@@ -183,13 +359,17 @@ gp_coffgen_make_block_section(gp_object_t *Object, unsigned int Num_sections)
     return NULL;
   }
 
+  _section_index_clear(Object);
+  _linenum_index_clear(Object);
   ptr_array = (gp_section_t **)gp_list_make_block(&Object->section_list, Num_sections, sizeof(gp_section_t));
 
   id = Object->serial_id;
+  gp_thread_lock();
   for (i = 0; i < Num_sections; i++) {
     ptr_array[i]->object_id = id;
     ptr_array[i]->serial_id = section_serial_id++;
   }
+  gp_thread_unlock();
 
   /* The first->prev and last->next values is already NULL. */
 
@@ -209,8 +389,10 @@ gp_coffgen_add_exists_section(gp_object_t *Object, gp_section_t *Section)
     return NULL;
   }
 
+  _linenum_index_clear(Object);
   gp_list_node_append(&Object->section_list, Section);
   Section->object_id = Object->serial_id;
+  _section_index_append(Object, Section);
 
   return Section;
 }
@@ -232,6 +414,9 @@ gp_coffgen_insert_after_section(gp_object_t *Object, gp_section_t *Ancestor, gp_
     assert(0);
   }
 
+  /* The places of the following sections change. */
+  _section_index_clear(Object);
+  _linenum_index_clear(Object);
   gp_list_node_insert_after(&Object->section_list, Ancestor, Following);
   Following->object_id = Object->serial_id;
 
@@ -263,6 +448,8 @@ gp_coffgen_transfer_section_data(gp_section_t *Receiver, gp_section_t *Sender)
     return;
   }
 
+  gp_coffgen_invalidate_linenum_index(Receiver);
+  gp_coffgen_invalidate_linenum_index(Sender);
   gp_list_move(&Receiver->relocation_list, &Sender->relocation_list);
   gp_list_move(&Receiver->line_number_list, &Sender->line_number_list);
 }
@@ -416,6 +603,8 @@ gp_coffgen_move_reserve_section(gp_object_t *Object, gp_section_t *Section)
     assert(0);
   }
 
+  _section_index_remove(Object, Section);
+  _linenum_index_clear(Object);
   gp_list_node_move(&Object->dead_section_list, &Object->section_list, Section);
   _decrease_relocation_counts(Section);
   return Section;
@@ -438,6 +627,8 @@ gp_coffgen_del_section(gp_object_t *Object, gp_section_t *Section)
     assert(0);
   }
 
+  _section_index_remove(Object, Section);
+  _linenum_index_clear(Object);
   gp_list_node_remove(&Object->section_list, Section);
   gp_coffgen_free_section(Section);
   return true;
@@ -759,6 +950,60 @@ gp_coffgen_del_symbol(gp_object_t *Object, gp_symbol_t *Symbol, gp_boolean Touch
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Delete all external symbols from the object. The symbol list is rebuilt in one walk. */
+
+unsigned int
+gp_coffgen_del_external_symbols(gp_object_t *Object)
+{
+  gp_symbol_t  *symbol;
+  gp_symbol_t  *next;
+  gp_symbol_t  *last;
+  unsigned int  n_symbols;
+  unsigned int  n_deleted;
+
+  n_symbols = 0;
+  n_deleted = 0;
+  last      = NULL;
+  symbol    = Object->symbol_list.first;
+  while (symbol != NULL) {
+    next = symbol->next;
+
+    if (gp_coffgen_is_external_symbol(symbol)) {
+      gp_debug("  removed symbol \"%s\"", symbol->name);
+      n_deleted += 1 + gp_coffgen_free_symbol(symbol);
+      ++n_symbols;
+    }
+    else {
+      /* Links the kept symbol after the previous kept one. */
+      symbol->prev = last;
+      if (last != NULL) {
+        last->next = symbol;
+      }
+      else {
+        Object->symbol_list.first = symbol;
+      }
+      last = symbol;
+    }
+
+    symbol = next;
+  }
+
+  if (last != NULL) {
+    last->next = NULL;
+  }
+  else {
+    Object->symbol_list.first = NULL;
+  }
+
+  Object->symbol_list.last       = last;
+  Object->symbol_list.curr       = Object->symbol_list.first;
+  Object->symbol_list.num_nodes -= n_symbols;
+  Object->num_symbols           -= n_deleted;
+  return n_symbols;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Make an array from symbol list of object. */
 
 gp_symbol_t **
@@ -954,7 +1199,9 @@ _clear_relocation_counts(const gp_object_t *Object)
 
   section = Object->section_list.first;
   while (section != NULL) {
-    section->reloc_count = 0;
+    section->reloc_count       = 0;
+    section->protected_by      = NULL;
+    section->protected_through = NULL;
 
     if (FlagsIsNotAllClr(section->flags, STYP_ABS | STYP_DATA)) {
       /* This section get protection immediately. The additional sections' protection
@@ -979,117 +1226,119 @@ _clear_relocation_counts(const gp_object_t *Object)
 
 /*------------------------------------------------------------------------------------------------*/
 
-static gp_boolean
-_check_section_relocations(proc_class_t Class, gp_section_t *Section, unsigned int Pass,
-                           unsigned int Behavior, unsigned int Level)
+static void
+_count_section_relocations(proc_class_t Class, gp_section_t *Section, unsigned int Behavior)
 {
   gp_reloc_t   *relocation;
   gp_symbol_t  *symbol;
   gp_section_t *sym_sect;
-  gp_boolean    use_counters;
-  gp_boolean    change;
 
-  if (Level >= CHECK_RELOCATIONS_DEPTH_MAX) {
-    gp_warning("Depth of relocations check reached the limit: %u", CHECK_RELOCATIONS_DEPTH_MAX);
-    return false;
-  }
-
-  use_counters = (Pass == 0) ? true : false;
-  change       = false;
-  relocation   = Section->relocation_list.first;
+  relocation = Section->relocation_list.first;
   while (relocation != NULL) {
     symbol = relocation->symbol;
-    if (use_counters) {
-      (symbol->reloc_count_all_section)++;
-    }
+    (symbol->reloc_count_all_section)++;
 
     sym_sect = symbol->section;
     if (sym_sect == NULL) {
       /* This is an orphan symbol. */
       if (FlagIsClr(Behavior, RELOC_DISABLE_WARN)) {
         if (FlagIsSet(Behavior, RELOC_ENABLE_CINIT_WARN) || (strcmp(symbol->name, "_cinit") != 0)) {
-          gp_warning("Relocation symbol \"%s\" [0x%0*X] has no section. (pass %u)",
-                     symbol->name, Class->addr_digits, relocation->address, Pass);
+          gp_warning("Relocation symbol \"%s\" [0x%0*X] has no section.",
+                     symbol->name, Class->addr_digits, relocation->address);
         }
       }
     }
+    else if (sym_sect == Section) {
+      /* Relocation reference from own section. */
+      (symbol->reloc_count_own_section)++;
+    }
     else {
-      if (sym_sect == Section) {
-        /* In this case not change the level of protection. */
-        if (use_counters) {
-          (symbol->reloc_count_own_section)++;
-        }
-      }
-      else {
-        /* The symbol is located another section. */
-        if (use_counters) {
-          (symbol->reloc_count_other_section)++;
-          (sym_sect->reloc_count)++;
-        }
-
-        if (FlagIsSet(Section->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
-          /* If the section of reference is protected, then the section of symbol also will
-             be protected. */
-          if (FlagIsClr(sym_sect->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
-            /* Only then modify and check if have not been under protection. */
-            FlagSet(sym_sect->opt_flags, OPT_FLAGS_PROTECTED_SECTION);
-            change = _check_section_relocations(Class, sym_sect, Pass, Behavior, Level + 1);
-          }
-        }
-      }
+      /* The symbol is located another section. */
+      (symbol->reloc_count_other_section)++;
+      (sym_sect->reloc_count)++;
     }
+
     relocation = relocation->next;
   }
-
-  return change;
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-static gp_boolean
-_check_object_relocations(const gp_object_t *Object, unsigned int Pass, unsigned int Behavior)
+/* Protect every section which can be reached through the relocations from an already protected
+   section. The sections are visited in breadth-first order, so the section which gives the
+   protection is the nearest to a protected section. */
+
+static void
+_protect_referenced_sections(const gp_object_t *Object, unsigned int Behavior)
 {
-  proc_class_t  class;
-  gp_section_t *section;
-  gp_boolean    change;
-  unsigned int  level;
+  gp_section_t     **queue;
+  size_t             head;
+  size_t             tail;
+  gp_section_t      *section;
+  gp_section_t      *sym_sect;
+  const gp_reloc_t  *relocation;
+
+  if (Object->section_list.num_nodes == 0) {
+    return;
+  }
+
+  queue = (gp_section_t **)GP_Malloc(Object->section_list.num_nodes * sizeof(gp_section_t *));
+  head  = 0;
+  tail  = 0;
 
-  level   = 0;
-  change  = false;
-  class   = Object->class;
   section = Object->section_list.first;
   while (section != NULL) {
-    change |= _check_section_relocations(class, section, Pass, Behavior, level);
+    if (FlagIsSet(section->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
+      queue[tail++] = section;
+    }
     section = section->next;
   }
 
-  return change;
+  /* Every section is queued at most once, when it gets the protection. */
+  while (head < tail) {
+    section    = queue[head++];
+    relocation = section->relocation_list.first;
+    while (relocation != NULL) {
+      sym_sect = relocation->symbol->section;
+
+      if ((sym_sect != NULL) && FlagIsClr(sym_sect->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
+        FlagSet(sym_sect->opt_flags, OPT_FLAGS_PROTECTED_SECTION);
+        sym_sect->protected_by      = section;
+        sym_sect->protected_through = relocation->symbol;
+        queue[tail++] = sym_sect;
+
+        /* The earlier recursive check counted the relocations of such a section twice. The
+           removal of the Pagesel and Banksel directives is based on these counters, so they
+           remain the same. */
+        _count_section_relocations(Object->class, sym_sect, Behavior | RELOC_DISABLE_WARN);
+      }
+
+      relocation = relocation->next;
+    }
+  }
+
+  free(queue);
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Handle the relocation counters of sections and symbols. */
+/* Handle the relocation counters of sections and symbols, and protect the sections which are
+   referenced from the protected sections. */
 
 void
-gp_coffgen_check_relocations(const gp_object_t *Object, gp_boolean Enable_cinit_warns)
+gp_coffgen_check_relocations(const gp_object_t *Object, unsigned int Behavior)
 {
-  unsigned int pass;
+  gp_section_t *section;
 
   _clear_relocation_counts(Object);
-  pass = 0;
-  while (true) {
-    /* Need for further rounds because may occur back and forth references. */
-    if (!_check_object_relocations(Object, pass, Enable_cinit_warns)) {
-      break;
-    }
-
-    ++pass;
 
-    if (pass > CHECK_RELOCATIONS_PASS_MAX) {
-      gp_warning("Number of relocations check reached the limit: %u", CHECK_RELOCATIONS_PASS_MAX);
-      break;
-    }
+  section = Object->section_list.first;
+  while (section != NULL) {
+    _count_section_relocations(Object->class, section, Behavior);
+    section = section->next;
   }
+
+  _protect_referenced_sections(Object, Behavior);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -1210,6 +1459,139 @@ gp_coffgen_reloc_type_to_str(uint16_t Type)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* A line number and its place in the list of line numbers. */
+
+typedef struct linenum_place {
+  gp_linenum_t *linenum;
+  unsigned int  pos;
+} linenum_place_t;
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Drop the ordered arrays of line numbers of the section, because its line numbers have changed. */
+
+void
+gp_coffgen_invalidate_linenum_index(gp_section_t *Section)
+{
+  if (Section->line_numbers_array != NULL) {
+    free(Section->line_numbers_array);
+    Section->line_numbers_array        = NULL;
+    Section->line_numbers_array_length = 0;
+  }
+
+  if (Section->linenum_address_array != NULL) {
+    free(Section->linenum_address_array);
+    Section->linenum_address_array        = NULL;
+    Section->linenum_address_array_length = 0;
+  }
+
+  if (Section->linenum_index != NULL) {
+    Section->linenum_index->valid = false;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static int
+_linenum_place_cmp(const void *P0, const void *P1)
+{
+  const linenum_place_t *p0 = (const linenum_place_t *)P0;
+  const linenum_place_t *p1 = (const linenum_place_t *)P1;
+
+  if (p0->linenum->address != p1->linenum->address) {
+    return ((p0->linenum->address < p1->linenum->address) ? -1 : 1);
+  }
+
+  /* From among the identical addresses the first in the list goes ahead. */
+  return ((p0->pos < p1->pos) ? -1 : ((p0->pos > p1->pos) ? 1 : 0));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Create the array of line numbers of the section, which is ordered by address. */
+
+static void
+_linenum_address_array_make(gp_section_t *Section)
+{
+  gp_linenum_t     *linenum;
+  gp_linenum_t    **array;
+  linenum_place_t  *places;
+  unsigned int      n_linenums;
+  gp_boolean        sorted;
+  unsigned int      i;
+
+  n_linenums = Section->line_number_list.num_nodes;
+  array      = (gp_linenum_t **)GP_Malloc(n_linenums * sizeof(gp_linenum_t *));
+  sorted     = true;
+  i          = 0;
+  linenum    = Section->line_number_list.first;
+  while (linenum != NULL) {
+    if ((i > 0) && (array[i - 1]->address > linenum->address)) {
+      sorted = false;
+    }
+
+    array[i] = linenum;
+    ++i;
+    linenum = linenum->next;
+  }
+
+  /* The assembler emits the line numbers in ascending order, so mostly there is nothing to do. */
+  if (!sorted) {
+    places = (linenum_place_t *)GP_Malloc(n_linenums * sizeof(linenum_place_t));
+
+    for (i = 0; i < n_linenums; i++) {
+      places[i].linenum = array[i];
+      places[i].pos     = i;
+    }
+
+    qsort(places, n_linenums, sizeof(linenum_place_t), _linenum_place_cmp);
+
+    for (i = 0; i < n_linenums; i++) {
+      array[i] = places[i].linenum;
+    }
+
+    free(places);
+  }
+
+  Section->linenum_address_array        = array;
+  Section->linenum_address_array_length = n_linenums;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Find the place of the first line number in the address array, which is not below the address. */
+
+static unsigned int
+_linenum_address_lower_bound(gp_section_t *Section, unsigned int Address)
+{
+  gp_linenum_t **array;
+  unsigned int   low;
+  unsigned int   high;
+  unsigned int   mid;
+
+  if (Section->linenum_address_array == NULL) {
+    _linenum_address_array_make(Section);
+  }
+
+  array = Section->linenum_address_array;
+  low   = 0;
+  high  = Section->linenum_address_array_length;
+  while (low < high) {
+    mid = low + (high - low) / 2;
+
+    if (array[mid]->address < Address) {
+      low = mid + 1;
+    }
+    else {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Allocate a block of line numbers. -- gpreadobj.c */
 
 gp_linenum_t *
@@ -1228,6 +1610,7 @@ gp_coffgen_make_block_linenum(gp_section_t *Section, unsigned int Num_linenums)
     return NULL;
   }
 
+  gp_coffgen_invalidate_linenum_index(Section);
   ptr_array = (gp_linenum_t **)gp_list_make_block(&Section->line_number_list, Num_linenums, sizeof(gp_linenum_t));
 
   id = Section->serial_id;
@@ -1249,6 +1632,8 @@ gp_coffgen_add_linenum(gp_section_t *Section)
 {
   gp_linenum_t *new;
 
+  gp_coffgen_invalidate_linenum_index(Section);
+
   /* allocate memory for the line number */
   new = (gp_linenum_t *)gp_list_node_append(&Section->line_number_list, gp_list_node_new(sizeof(gp_linenum_t)));
   new->section_id = Section->serial_id;
@@ -1273,6 +1658,7 @@ gp_coffgen_del_linenum(gp_section_t *Section, gp_linenum_t *Linenum)
     assert(0);
   }
 
+  gp_coffgen_invalidate_linenum_index(Section);
   gp_list_node_delete(&Section->line_number_list, Linenum);
   return true;
 }
@@ -1284,18 +1670,16 @@ gp_coffgen_del_linenum(gp_section_t *Section, gp_linenum_t *Linenum)
 gp_linenum_t *
 gp_coffgen_find_linenum_by_address(gp_section_t *Section, unsigned int Address)
 {
-  gp_linenum_t *linenum;
+  unsigned int i;
 
   if (Section->line_number_list.first == NULL) {
     return NULL;
   }
 
-  linenum = Section->line_number_list.first;
-  while (linenum != NULL) {
-    if (linenum->address == Address) {
-      return linenum;
-    }
-    linenum = linenum->next;
+  i = _linenum_address_lower_bound(Section, Address);
+
+  if ((i < Section->linenum_address_array_length) && (Section->linenum_address_array[i]->address == Address)) {
+    return Section->linenum_address_array[i];
   }
 
   return NULL;
@@ -1327,24 +1711,28 @@ unsigned int
 gp_coffgen_del_linenum_by_address_area(gp_section_t *Section, unsigned int Address_start,
                                        unsigned int Address_end)
 {
-  gp_linenum_t *linenum;
-  gp_linenum_t *next;
-  unsigned int  num;
+  gp_linenum_t **array;
+  unsigned int   length;
+  unsigned int   i;
+  unsigned int   num;
 
   if (Section->line_number_list.first == NULL) {
-    return false;
+    return 0;
   }
 
-  num     = 0;
-  linenum = Section->line_number_list.first;
-  while ((linenum != NULL) && (linenum->address <= Address_end)) {
-    next = linenum->next;
-
-    if (linenum->address >= Address_start) {
-      num += (gp_coffgen_del_linenum(Section, linenum) != false) ? 1 : 0;
-    }
+  i      = _linenum_address_lower_bound(Section, Address_start);
+  array  = Section->linenum_address_array;
+  length = Section->linenum_address_array_length;
+  num    = 0;
+  /* The array is dropped only after the last deletion. */
+  while ((i < length) && (array[i]->address <= Address_end)) {
+    gp_list_node_delete(&Section->line_number_list, array[i]);
+    ++num;
+    ++i;
+  }
 
-    linenum = next;
+  if (num > 0) {
+    gp_coffgen_invalidate_linenum_index(Section);
   }
 
   return num;
@@ -1383,62 +1771,88 @@ _linenum_cmp(const void *P0, const void *P1)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Create line number array. Use gplink/gplink.c */
+/* Create the line number array of a section. */
 
-void
-gp_coffgen_make_linenum_array(gp_object_t *Object)
+static void
+_linenum_array_make(gp_section_t *Section)
 {
-  gp_section_t  *section;
   gp_linenum_t  *linenum;
   gp_linenum_t **array;
   unsigned int   n_linenums;
   unsigned int   prev_num;
   unsigned int   i;
 
-  section = Object->section_list.first;
-  while (section != NULL) {
-    n_linenums = section->line_number_list.num_nodes;
-    array      = (gp_linenum_t **)GP_Malloc(n_linenums * sizeof(gp_linenum_t *));
-    i          = 0;
-    prev_num   = (unsigned int)(-1);
-    linenum    = section->line_number_list.first;
-    while (linenum != NULL) {
-      /* From among identical line numbers only places the first in the array. */
-      if (prev_num != linenum->line_number) {
-        array[i] = linenum;
-        ++i;
-        prev_num = linenum->line_number;
-      }
+  n_linenums = Section->line_number_list.num_nodes;
+
+  if (n_linenums == 0) {
+    return;
+  }
 
-      linenum = linenum->next;
+  array    = (gp_linenum_t **)GP_Malloc(n_linenums * sizeof(gp_linenum_t *));
+  i        = 0;
+  prev_num = (unsigned int)(-1);
+  linenum  = Section->line_number_list.first;
+  while (linenum != NULL) {
+    /* From among identical line numbers only places the first in the array. */
+    if (prev_num != linenum->line_number) {
+      array[i] = linenum;
+      ++i;
+      prev_num = linenum->line_number;
     }
 
-    /* Reduces the required memory size. */
-    array = (gp_linenum_t **)GP_Realloc(array, i * sizeof(gp_linenum_t *));
-    section->line_numbers_array        = array;
-    section->line_numbers_array_length = i;
+    linenum = linenum->next;
+  }
+
+  /* Reduces the required memory size. */
+  array = (gp_linenum_t **)GP_Realloc(array, i * sizeof(gp_linenum_t *));
+  Section->line_numbers_array        = array;
+  Section->line_numbers_array_length = i;
+
+  qsort(array, i, sizeof(gp_linenum_t *), _linenum_cmp);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Create line number array. Use gplink/gplink.c */
+
+void
+gp_coffgen_make_linenum_array(gp_object_t *Object)
+{
+  gp_section_t *section;
+
+  section = Object->section_list.first;
+  while (section != NULL) {
+    if (section->line_numbers_array == NULL) {
+      _linenum_array_make(section);
+    }
 
-    qsort(array, i, sizeof(gp_linenum_t *), _linenum_cmp);
     section = section->next;
   }
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Find a line number in array by symbol and number. Use gplink/lst.c */
+/* Find a line number in array by symbol and number. */
 
 gp_linenum_t *
-gp_coffgen_find_linenum(const gp_section_t *Section, const gp_symbol_t *Symbol,
-                        unsigned int Line_number)
+gp_coffgen_find_linenum(gp_section_t *Section, const gp_symbol_t *Symbol, unsigned int Line_number)
 {
   gp_linenum_t   linenum;
   gp_linenum_t  *ptr;
   gp_linenum_t **ret;
 
-  if ((Section == NULL) || (Section->line_numbers_array == NULL)) {
+  if (Section == NULL) {
     return NULL;
   }
 
+  if (Section->line_numbers_array == NULL) {
+    _linenum_array_make(Section);
+
+    if (Section->line_numbers_array == NULL) {
+      return NULL;
+    }
+  }
+
   linenum.symbol      = Symbol;
   linenum.line_number = Line_number;
   ptr = &linenum;
@@ -1449,6 +1863,141 @@ gp_coffgen_find_linenum(const gp_section_t *Section, const gp_symbol_t *Symbol,
 
 /*------------------------------------------------------------------------------------------------*/
 
+static int
+_linenum_key_cmp(const void *P0, const void *P1)
+{
+  const linenum_key_t *k0 = (const linenum_key_t *)P0;
+  const linenum_key_t *k1 = (const linenum_key_t *)P1;
+
+  if (k0->symbol != k1->symbol) {
+    return ((k0->symbol < k1->symbol) ? -1 : 1);
+  }
+
+  if (k0->line_number != k1->line_number) {
+    return ((k0->line_number < k1->line_number) ? -1 : 1);
+  }
+
+  return 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static int
+_linenum_key_pos_cmp(const void *P0, const void *P1)
+{
+  const linenum_key_t *k0 = (const linenum_key_t *)P0;
+  const linenum_key_t *k1 = (const linenum_key_t *)P1;
+  int                  ret;
+
+  ret = _linenum_key_cmp(P0, P1);
+
+  if (ret != 0) {
+    return ret;
+  }
+
+  return ((k0->section_pos < k1->section_pos) ? -1 : ((k0->section_pos > k1->section_pos) ? 1 : 0));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Create the line number index of an object from the line number arrays of its sections. */
+
+static void
+_linenum_index_build(gp_object_t *Object)
+{
+  gp_linenum_index_t *index;
+  gp_section_t       *section;
+  gp_linenum_t      **array;
+  linenum_key_t      *keys;
+  unsigned int        num_keys;
+  unsigned int        pos;
+  unsigned int        i;
+  unsigned int        n;
+
+  num_keys = 0;
+  section  = Object->section_list.first;
+  while (section != NULL) {
+    if (section->line_numbers_array == NULL) {
+      _linenum_array_make(section);
+    }
+
+    num_keys += section->line_numbers_array_length;
+    section   = section->next;
+  }
+
+  index = (gp_linenum_index_t *)GP_Calloc(1, sizeof(gp_linenum_index_t));
+  keys  = (linenum_key_t *)GP_Malloc(num_keys * sizeof(linenum_key_t));
+  n     = 0;
+  pos   = 0;
+  section = Object->section_list.first;
+  while (section != NULL) {
+    array = section->line_numbers_array;
+    for (i = 0; i < section->line_numbers_array_length; i++) {
+      keys[n].symbol      = array[i]->symbol;
+      keys[n].line_number = array[i]->line_number;
+      keys[n].section     = section;
+      keys[n].section_pos = pos;
+      ++n;
+    }
+
+    section->linenum_index = index;
+    section = section->next;
+    ++pos;
+  }
+
+  qsort(keys, n, sizeof(linenum_key_t), _linenum_key_pos_cmp);
+
+  /* Only the first section keeps the line. */
+  num_keys = 0;
+  for (i = 0; i < n; i++) {
+    if ((num_keys == 0) || (keys[num_keys - 1].symbol != keys[i].symbol) ||
+        (keys[num_keys - 1].line_number != keys[i].line_number)) {
+      keys[num_keys] = keys[i];
+      ++num_keys;
+    }
+  }
+
+  index->keys     = keys;
+  index->num_keys = num_keys;
+  index->valid    = true;
+  Object->linenum_index = index;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Find a line number by symbol and number in the first section of the object which contains it.
+   Use gplink/lst.c */
+
+gp_linenum_t *
+gp_coffgen_find_object_linenum(gp_object_t *Object, const gp_symbol_t *Symbol, unsigned int Line_number,
+                               gp_section_t **Section)
+{
+  linenum_key_t  key;
+  linenum_key_t *ret;
+
+  if ((Object->linenum_index == NULL) || (!Object->linenum_index->valid)) {
+    _linenum_index_clear(Object);
+    _linenum_index_build(Object);
+  }
+
+  key.symbol      = Symbol;
+  key.line_number = Line_number;
+  ret = (linenum_key_t *)bsearch(&key, Object->linenum_index->keys, Object->linenum_index->num_keys,
+                                 sizeof(linenum_key_t), _linenum_key_cmp);
+
+  if (ret == NULL) {
+    return NULL;
+  }
+
+  if (Section != NULL) {
+    *Section = ret->section;
+  }
+
+  return gp_coffgen_find_linenum(ret->section, Symbol, Line_number);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* check if the object is absolute: all sections are absolute and there
    are no relocations (undefined symbols) */
 
@@ -1554,10 +2103,7 @@ gp_coffgen_free_section(gp_section_t *Section)
 
   gp_list_delete(&Section->relocation_list);
   gp_list_delete(&Section->line_number_list);
-
-  if (Section->line_numbers_array != NULL) {
-    free(Section->line_numbers_array);
-  }
+  gp_coffgen_invalidate_linenum_index(Section);
 
   free(Section->name);
   free(Section);
@@ -1602,6 +2148,8 @@ gp_coffgen_free_object(gp_object_t *Object)
     return false;
   }
 
+  _section_index_clear(Object);
+  _linenum_index_clear(Object);
   gp_list_delete(&Object->section_list);
   gp_list_delete(&Object->dead_section_list);
 
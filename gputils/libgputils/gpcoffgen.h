@@ -74,6 +74,7 @@ extern gp_aux_t *gp_coffgen_add_aux(gp_object_t *Object, gp_symbol_t *Symbol);
 extern gp_aux_t *gp_coffgen_make_block_aux(gp_symbol_t *Symbol, unsigned int Num_auxsyms);
 extern gp_symbol_t *gp_coffgen_move_reserve_symbol(gp_object_t *Object, gp_symbol_t *Symbol);
 extern gp_boolean gp_coffgen_del_symbol(gp_object_t *Object, gp_symbol_t *Symbol, gp_boolean Touch_number);
+extern unsigned int gp_coffgen_del_external_symbols(gp_object_t *Object);
 extern gp_symbol_t **gp_coffgen_make_symbol_array(const gp_object_t *Object, int (*Cmp)(const void *, const void *));
 extern const char *gp_coffgen_symbol_type_to_str(uint8_t Type);
 extern const char *gp_coffgen_symbol_derived_type_to_str(uint32_t Type);
@@ -95,6 +96,7 @@ extern const char *gp_coffgen_reloc_type_to_str(uint16_t Type);
 
     /*................................*/
 
+extern void gp_coffgen_invalidate_linenum_index(gp_section_t *Section);
 extern gp_linenum_t *gp_coffgen_make_block_linenum(gp_section_t *Section, unsigned int Num_linenums);
 extern gp_linenum_t *gp_coffgen_add_linenum(gp_section_t *Section);
 extern gp_linenum_t *gp_coffgen_find_linenum_by_address(gp_section_t *Section, unsigned int Address);
@@ -105,9 +107,12 @@ extern unsigned int gp_coffgen_del_linenum_by_address_area(gp_section_t *Section
 
 extern void gp_coffgen_make_linenum_array(gp_object_t *Object);
 
-extern gp_linenum_t *gp_coffgen_find_linenum(const gp_section_t *Section, const gp_symbol_t *Symbol,
+extern gp_linenum_t *gp_coffgen_find_linenum(gp_section_t *Section, const gp_symbol_t *Symbol,
                                              unsigned int Line_number);
 
+extern gp_linenum_t *gp_coffgen_find_object_linenum(gp_object_t *Object, const gp_symbol_t *Symbol,
+                                                    unsigned int Line_number, gp_section_t **Section);
+
 
     /*................................*/
 
@@ -29,6 +29,9 @@ Boston, MA 02111-1307, USA.  */
 
 gp_boolean gp_relocate_to_shared = false;
 
+/* The number of bytes looked at by _search_memory(), for the time report of gplink. */
+size_t     gp_cofflink_searched_bytes = 0;
+
 /*------------------------------------------------------------------------------------------------*/
 
 /* Two symbol tables are constructed. The first contains the definitions of all
@@ -166,6 +169,67 @@ gp_cofflink_combine_objects(gp_object_t *Object)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Find the definition of an external symbol. */
+
+static gp_symbol_t *
+_find_definition(symbol_table_t *Symbols, const char *Name)
+{
+  const symbol_t        *sym;
+  const gp_coffsymbol_t *var;
+
+  sym = gp_sym_get_symbol(Symbols, Name);
+  if (sym == NULL) {
+    return NULL;
+  }
+
+  var = (const gp_coffsymbol_t *)gp_sym_get_symbol_annotation(sym);
+  if (var == NULL) {
+    return NULL;
+  }
+
+  return var->symbol;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Resolve every external symbol of the object only once. The relocations share these symbols.
+   The "number" of a symbol is only valid while reading or writing a file, until then it holds
+   the index of the definition. */
+
+static gp_symbol_t **
+_resolve_external_symbols(gp_object_t *Object, symbol_table_t *Symbols)
+{
+  gp_symbol_t  *symbol;
+  gp_symbol_t **definitions;
+  unsigned int  i;
+
+  if (Object->symbol_list.num_nodes == 0) {
+    return NULL;
+  }
+
+  definitions = (gp_symbol_t **)GP_Malloc(Object->symbol_list.num_nodes * sizeof(gp_symbol_t *));
+
+  i      = 0;
+  symbol = Object->symbol_list.first;
+  while (symbol != NULL) {
+    if (gp_coffgen_is_external_symbol(symbol)) {
+      definitions[i] = _find_definition(Symbols, symbol->name);
+      symbol->number = i;
+      FlagSet(symbol->opt_flags, OPT_FLAGS_GPCOFFLINK_MODULE);
+      ++i;
+    }
+    else {
+      FlagClr(symbol->opt_flags, OPT_FLAGS_GPCOFFLINK_MODULE);
+    }
+
+    symbol = symbol->next;
+  }
+
+  return definitions;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Cleanup the symbol table after combining objects. */
 
 void
@@ -174,14 +238,16 @@ gp_cofflink_clean_table(gp_object_t *Object, symbol_table_t *Symbols)
   gp_section_t          *section;
   gp_reloc_t            *relocation;
   gp_symbol_t           *symbol;
+  gp_symbol_t           *definition;
+  gp_symbol_t          **definitions;
   const gp_coffsymbol_t *var;
   const symbol_t        *sym;
-  gp_symbol_t           *next;
   int                    num_clean_errors;
 
   gp_debug("Cleaning symbol table.");
 
   num_clean_errors = gp_real_num_errors();
+  definitions      = _resolve_external_symbols(Object, Symbols);
 
   /* point all relocations to the symbol definitions */
   section = Object->section_list.first;
@@ -192,6 +258,18 @@ gp_cofflink_clean_table(gp_object_t *Object, symbol_table_t *Symbols)
 
       if (gp_coffgen_is_external_symbol(symbol)) {
         /* This is an external symbol defined elsewhere. */
+        if (FlagIsSet(symbol->opt_flags, OPT_FLAGS_GPCOFFLINK_MODULE)) {
+          definition = definitions[symbol->number];
+        }
+        else {
+          definition = _find_definition(Symbols, symbol->name);
+        }
+
+        if (definition != NULL) {
+          relocation->symbol = definition;
+          goto _continue;
+        }
+
         sym = gp_sym_get_symbol(Symbols, symbol->name);
         if (sym == NULL) {
           gp_error("External symbol \"%s\" in section \"%s\" not found.", symbol->name, section->name);
@@ -204,13 +282,7 @@ gp_cofflink_clean_table(gp_object_t *Object, symbol_table_t *Symbols)
           goto _continue;
         }
 
-        if (var->symbol == NULL) {
-          gp_error("External symbol \"%s\" in section \"%s\" not provided.", symbol->name, section->name);
-          goto _continue;
-        }
-
-        symbol = var->symbol;
-        relocation->symbol = symbol;
+        gp_error("External symbol \"%s\" in section \"%s\" not provided.", symbol->name, section->name);
       }
 
 _continue:
@@ -220,21 +292,15 @@ _continue:
     section = section->next;
   }
 
+  if (definitions != NULL) {
+    free(definitions);
+  }
+
   if (gp_real_num_errors() > num_clean_errors) {
     exit(1);
   }
 
-  symbol = Object->symbol_list.first;
-  while (symbol != NULL) {
-    next = symbol->next;
-
-    if (gp_coffgen_is_external_symbol(symbol)) {
-      gp_debug("  removed symbol \"%s\"", symbol->name);
-      gp_coffgen_del_symbol(Object, symbol, true);
-    }
-
-    symbol = next;
-  }
+  gp_coffgen_del_external_symbols(Object);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -242,12 +308,17 @@ _continue:
 /* Update the line number offsets. */
 
 static void
-_update_line_numbers(gp_linenum_t *Line_number, unsigned int Offset)
+_update_line_numbers(gp_section_t *Section, unsigned int Offset)
 {
-  while (Line_number != NULL) {
-    Line_number->address += Offset;
-    Line_number = Line_number->next;
+  gp_linenum_t *line_number;
+
+  line_number = Section->line_number_list.first;
+  while (line_number != NULL) {
+    line_number->address += Offset;
+    line_number = line_number->next;
   }
+
+  gp_coffgen_invalidate_linenum_index(Section);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -360,107 +431,224 @@ gp_cofflink_make_stack(gp_object_t *Object, unsigned int Num_bytes)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Merge all sections in one object file with the same name. The overlayed
-   sections must have been combined first.  */
+/* The sections of the same name, in the order of the section list. */
 
-void
-gp_cofflink_merge_sections(gp_object_t *Object)
+typedef struct merge_group {
+  gp_section_t **members;
+  size_t         num_members;
+  size_t         max_members;
+} merge_group_t;
+
+/* A section which has been merged into the first section of its group. */
+
+typedef struct merged_section {
+  const gp_section_t *section;
+  gp_section_t       *target;
+  unsigned int        org;              /* The start of the section within the target. */
+} merged_section_t;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static int
+_merged_section_cmp(const void *P0, const void *P1)
+{
+  uintptr_t s0 = (uintptr_t)((const merged_section_t *)P0)->section;
+  uintptr_t s1 = (uintptr_t)((const merged_section_t *)P1)->section;
+
+  if (s0 < s1) {
+    return -1;
+  }
+
+  if (s0 > s1) {
+    return 1;
+  }
+
+  return 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Append the Second section to the end of the First one, but leave the symbols of the Second. */
+
+static unsigned int
+_merge_section(gp_object_t *Object, gp_section_t *First, gp_section_t *Second)
 {
   int           addr_digits;
-  gp_section_t *first;
-  gp_section_t *second;
-  gp_symbol_t  *symbol;
   gp_reloc_t   *relocation;
   unsigned int  section_org;
-  uint8_t       data;
-  const char   *section_name;
-  const char   *symbol_name;
-  unsigned int  last;
-  unsigned int  offset;
-  unsigned int  byte_addr;
 
-  addr_digits = Object->class->addr_digits;
-  first       = Object->section_list.first;
-  while (first != NULL) {
-    second = gp_coffgen_find_section(Object, first->next, first->name);
-
-    if (second != NULL) {
-      /* The sections must have the same properties or they can't be combined. */
-      if (FlagIsSet(first->flags, STYP_ABS) ||
-          FlagIsSet(second->flags, STYP_ABS) ||
-          (strcmp(first->name, ".config") == 0) ||
-          (strcmp(first->name, ".idlocs") == 0)) {
-        gp_error("File \"%s\", section \"%s\" (0x%0*X) is absolute but occurs in more than one file.",
-                 Object->filename, first->name, addr_digits, first->address);
-        exit(1);
-      }
+  /* The sections must have the same properties or they can't be combined. */
+  if (FlagIsSet(First->flags, STYP_ABS) ||
+      FlagIsSet(Second->flags, STYP_ABS) ||
+      (strcmp(First->name, ".config") == 0) ||
+      (strcmp(First->name, ".idlocs") == 0)) {
+    addr_digits = Object->class->addr_digits;
+    gp_error("File \"%s\", section \"%s\" (0x%0*X) is absolute but occurs in more than one file.",
+             Object->filename, First->name, addr_digits, First->address);
+    exit(1);
+  }
 
-      gp_debug("  merging section \"%s\" with section \"%s\"", first->name, second->name);
+  gp_debug("  merging section \"%s\" with section \"%s\"", First->name, Second->name);
 
-      /* Update the addresses in the relocation table. */
-      relocation = second->relocation_list.first;
-      while (relocation != NULL) {
-        relocation->address += first->size;
-        relocation = relocation->next;
-      }
+  /* Update the addresses in the relocation table. */
+  relocation = Second->relocation_list.first;
+  while (relocation != NULL) {
+    relocation->address += First->size;
+    relocation = relocation->next;
+  }
 
-      /* Copy the section data. */
-      if (gp_coffgen_section_has_data(second)) {
-        last   = second->size;
-        offset = first->size;
+  /* Copy the section data. */
+  if (gp_coffgen_section_has_data(Second)) {
+    if (!gp_coffgen_section_has_data(First)) {
+      First->data = gp_mem_i_create();
+    }
 
-        if (!gp_coffgen_section_has_data(first)) {
-          /* TODO optimization: adopt data from second by moving second->size bytes from org to org + offset */
-          first->data = gp_mem_i_create();
-        }
+    if (gp_mem_b_copy_area(First->data, First->size, Second->data, 0, Second->size) != Second->size) {
+      assert(0);
+    }
+  }
 
-        for (byte_addr = 0; byte_addr < last; byte_addr++) {
-          if (gp_mem_b_get(second->data, byte_addr, &data, &section_name, &symbol_name)) {
-            gp_mem_b_put(first->data, byte_addr + offset, data, section_name, symbol_name);
-          }
-          else {
-            assert(0);
-          }
-        }
-      }
+  /* Update the line number offsets. */
+  _update_line_numbers(Second, First->size);
 
-      /* Update the line number offsets. */
-      _update_line_numbers(second->line_number_list.first, first->size);
+  if (FlagIsSet(First->flags, STYP_ROM_AREA)) {
+    section_org = gp_processor_insn_from_byte_c(Object->class, First->size);
+  }
+  else {
+    section_org = First->size;
+  }
+
+  /* Add section sizes. */
+  First->size += Second->size;
+
+  /* Append the relocations from the second section to the first. */
+  /* Append the line numbers from the second section to the first. */
+  gp_coffgen_transfer_section_data(First, Second);
+  return section_org;
+}
+
+/*------------------------------------------------------------------------------------------------*/
 
-      if (FlagIsSet(first->flags, STYP_ROM_AREA)) {
-        section_org = gp_processor_insn_from_byte_c(Object->class, first->size);
+/* Merge all sections in one object file with the same name. The overlayed
+   sections must have been combined first.
+
+   The sections are grouped by their names in one pass, the later sections of
+   a group are appended to the first one in the order of the section list, then
+   the symbols of all merged sections are moved in one pass. */
+
+void
+gp_cofflink_merge_sections(gp_object_t *Object)
+{
+  symbol_table_t   *names;
+  symbol_t         *sym;
+  merge_group_t    *groups;
+  merge_group_t    *group;
+  size_t            num_groups;
+  merged_section_t *merged;
+  merged_section_t *found;
+  merged_section_t  key;
+  size_t            num_merged;
+  gp_section_t     *section;
+  gp_symbol_t      *symbol;
+  size_t            num_sections;
+  size_t            i;
+  size_t            j;
+
+  num_sections = Object->section_list.num_nodes;
+  if (num_sections < 2) {
+    return;
+  }
+
+  /* Group the sections by their names. */
+  names      = gp_sym_push_arena_table(NULL, false);
+  groups     = (merge_group_t *)GP_Calloc(num_sections, sizeof(merge_group_t));
+  num_groups = 0;
+  num_merged = 0;
+
+  section = Object->section_list.first;
+  while (section != NULL) {
+    if (section->name != NULL) {
+      sym   = gp_sym_add_symbol(names, section->name);
+      group = (merge_group_t *)gp_sym_get_symbol_annotation(sym);
+
+      if (group == NULL) {
+        group = &groups[num_groups++];
+        gp_sym_annotate_symbol(sym, group);
       }
       else {
-        section_org = first->size;
+        ++num_merged;
       }
 
-      /* Update the symbol table. */
-      symbol = Object->symbol_list.first;
-      while (symbol != NULL) {
-        if ((symbol->section_number > N_UNDEF) && (symbol->section == second)) {
-          symbol->section  = first;
-          symbol->value   += section_org;
-        }
-        symbol = symbol->next;
+      if (group->num_members >= group->max_members) {
+        group->max_members = (group->max_members == 0) ? 4 : (group->max_members * 2);
+        group->members     = (gp_section_t **)GP_Realloc(group->members,
+                                                         group->max_members * sizeof(gp_section_t *));
       }
 
-      /* Add section sizes. */
-      first->size += second->size;
+      group->members[group->num_members++] = section;
+    }
 
-      /* Append the relocations from the second section to the first. */
-      /* Append the line numbers from the second section to the first. */
-      gp_coffgen_transfer_section_data(first, second);
-      gp_coffgen_update_all_section_id(first);
+    section = section->next;
+  }
 
-      /* Remove the second section. */
-      gp_coffgen_del_section(Object, second);
+  gp_sym_pop_table(names);
 
-      /* Take another pass. */
-      gp_cofflink_merge_sections(Object);
-      return;
+  if (num_merged == 0) {
+    for (i = 0; i < num_groups; ++i) {
+      free(groups[i].members);
+    }
+
+    free(groups);
+    return;
+  }
+
+  /* Append the sections of the groups to the first section of the group. */
+  merged     = (merged_section_t *)GP_Malloc(num_merged * sizeof(merged_section_t));
+  num_merged = 0;
+
+  for (i = 0; i < num_groups; ++i) {
+    group = &groups[i];
+
+    for (j = 1; j < group->num_members; ++j) {
+      merged[num_merged].section = group->members[j];
+      merged[num_merged].target  = group->members[0];
+      merged[num_merged].org     = _merge_section(Object, group->members[0], group->members[j]);
+      ++num_merged;
+    }
+
+    if (group->num_members > 1) {
+      gp_coffgen_update_all_section_id(group->members[0]);
     }
-    first = first->next;
   }
+
+  /* Update the symbol table. */
+  qsort(merged, num_merged, sizeof(merged_section_t), _merged_section_cmp);
+
+  symbol = Object->symbol_list.first;
+  while (symbol != NULL) {
+    if ((symbol->section_number > N_UNDEF) && (symbol->section != NULL)) {
+      key.section = symbol->section;
+      found = (merged_section_t *)bsearch(&key, merged, num_merged, sizeof(merged_section_t),
+                                          _merged_section_cmp);
+      if (found != NULL) {
+        symbol->section  = found->target;
+        symbol->value   += found->org;
+      }
+    }
+    symbol = symbol->next;
+  }
+
+  /* Remove the merged sections. */
+  for (i = 0; i < num_groups; ++i) {
+    for (j = 1; j < groups[i].num_members; ++j) {
+      gp_coffgen_del_section(Object, groups[i].members[j]);
+    }
+
+    free(groups[i].members);
+  }
+
+  free(groups);
+  free(merged);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -920,85 +1108,92 @@ _find_big_section(gp_section_t *Section, uint32_t Flags)
 
 /* Search through the target memory. Locate the smallest block of memory
    that is larger than the requested size. Return the address of that
-   block. */
+   block. The unused blocks are enumerated from the index of the used
+   areas, so this does not need to read every byte of the range.
+
+   Note: A block which reaches the Stop - 1 address is extended with the
+         Stop address, and a lonely unused Stop address is not a block. */
 
 static gp_boolean
-_search_memory(const MemBlock_t *M, unsigned int Org_to_byte_shift, unsigned int Start,
+_search_memory(MemBlock_t *M, unsigned int Org_to_byte_shift, unsigned int Start,
                unsigned int Stop, unsigned int Size, unsigned int *Block_address,
                unsigned int *Block_size, gp_boolean Stop_at_first)
 {
   unsigned int address;
-  unsigned int current_address = 0;
-  unsigned int current_size = 0;
-  gp_boolean   mem_used;
-  gp_boolean   in_block = false;
-  gp_boolean   end_block = false;
+  unsigned int current_address;
+  unsigned int current_size;
+  unsigned int current_end;
+  unsigned int end_address;
   gp_boolean   success = false;
-  uint8_t      byte;
 
   /* set the size to max value */
   *Block_size = (unsigned int)(-1);
 
-  for (address = Start; address <= Stop; address++) {
-    mem_used = gp_mem_b_get(M, address, &byte, NULL, NULL);
+  if (Start > Stop) {
+    return false;
+  }
 
-    if (address == Stop) {
-      if (in_block) {
-        /* end of the section definition */
-        end_block = true;
-        /* increment for last address */
-        current_size++;
-      }
-      else if (Start == Stop) {
-        /* special case, one word section */
-        if (! mem_used) {
-          end_block = true;
-          current_address = Start;
-          current_size    = 1;
-        }
-      }
-      in_block = false;
-    }
-    else if (mem_used) {
-      if (in_block) {
-        /* end of an unused block of memory */
-        end_block = true;
+  address = Start;
+  while (true) {
+    if (Start == Stop) {
+      /* special case, one word section */
+      ++gp_cofflink_searched_bytes;
+
+      if (gp_mem_b_is_used(M, Start)) {
+        break;
       }
-      in_block = false;
+
+      current_address = Start;
+      current_end     = Start;
+      current_size    = 1;
+      end_address     = Stop;
     }
     else {
-      if (! in_block) {
-        /* start of an unused block of memory */
-        gp_debug("    start unused block at %#x", gp_insn_from_byte(Org_to_byte_shift, address));
-        current_address = address;
-        current_size    = 1;
+      if (!gp_mem_b_find_unused(M, address, Stop - 1, &current_address, &current_end)) {
+        gp_cofflink_searched_bytes += Stop - address;
+        break;
+      }
+
+      gp_debug("    start unused block at %#x", gp_insn_from_byte(Org_to_byte_shift, current_address));
+      current_size = current_end - current_address + 1;
+
+      if (current_end == (Stop - 1)) {
+        /* end of the section definition, increment for last address */
+        end_address = Stop;
+        ++current_size;
       }
       else {
-        /* continuation of an unused block of memory */
-        current_size++;
+        /* end of an unused block of memory */
+        end_address = current_end + 1;
       }
-      in_block = true;
+
+      gp_cofflink_searched_bytes += end_address - address + 1;
     }
 
-    if (end_block) {
-      gp_debug("    end unused block at %#x with size %#x",
-               gp_insn_from_byte(Org_to_byte_shift, address),
-               gp_insn_from_byte(Org_to_byte_shift, current_size));
-      if (current_size >= Size) {
-        if (Stop_at_first) {
-          *Block_size    = current_size;
-          *Block_address = current_address;
-          success = true;
-          break;
-        }
-        else if (current_size < *Block_size) {
-          *Block_size    = current_size;
-          *Block_address = current_address;
-          success = true;
-        }
+    gp_debug("    end unused block at %#x with size %#x",
+             gp_insn_from_byte(Org_to_byte_shift, end_address),
+             gp_insn_from_byte(Org_to_byte_shift, current_size));
+
+    if (current_size >= Size) {
+      if (Stop_at_first) {
+        *Block_size    = current_size;
+        *Block_address = current_address;
+        success = true;
+        break;
+      }
+      else if (current_size < *Block_size) {
+        *Block_size    = current_size;
+        *Block_address = current_address;
+        success = true;
       }
-      end_block = false;
     }
+
+    if (end_address >= Stop) {
+      break;
+    }
+
+    /* The end_address is used. */
+    address = end_address + 1;
   }
 
   return success;
@@ -1171,7 +1366,7 @@ gp_cofflink_reloc_assigned(gp_object_t *Object, MemBlock_t *M, unsigned int Org_
                 section_name, p16e_align_needed);
 
       /* Update the line number offsets. */
-      _update_line_numbers(current->line_number_list.first, current->address);
+      _update_line_numbers(current, current->address);
 
       /* Set the relocated flag. */
       FlagSet(current->flags, STYP_RELOC);
@@ -1267,7 +1462,7 @@ gp_cofflink_reloc_cinit(gp_object_t *Object, MemBlock_t *M, unsigned int Org_to_
     _set_used(Object, M, 0, smallest_shadow_address, size, "cinit", Cinit_section->name, false);
 
     /* Update the line number offsets. */
-    _update_line_numbers(Cinit_section->line_number_list.first, Cinit_section->address);
+    _update_line_numbers(Cinit_section, Cinit_section->address);
 
     /* Set the relocated flag. */
     FlagSet(Cinit_section->flags, STYP_RELOC);
@@ -1418,7 +1613,7 @@ next_pass:
       _set_used(Object, M, 0, smallest_shadow_address, size, msg, current->name, p16e_align_needed);
 
       /* Update the line number offsets */
-      _update_line_numbers(current->line_number_list.first, current->address);
+      _update_line_numbers(current, current->address);
 
       /* Set the relocated flag */
       FlagSet(current->flags, STYP_RELOC);
@@ -1778,39 +1973,110 @@ _patch_addr(gp_object_t *Object, gp_section_t *Section, const gp_reloc_t *Reloca
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* The sections of gp_cofflink_patch() and the messages of each. */
+
+typedef struct patch_context {
+  gp_object_t          *object;
+  gp_section_t        **sections;
+  gp_message_buffer_t  *messages;
+  gp_boolean            mplink_compatible;
+} patch_context_t;
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Patch the data of a section with its relocations. */
+
+static void
+_patch_section(gp_object_t *Object, gp_section_t *Section, gp_boolean Mplink_compatible)
+{
+  const gp_reloc_t *relocation;
+
+  /* patch raw data with relocation entries */
+  relocation = Section->relocation_list.first;
+  while (relocation != NULL) {
+    _patch_addr(Object, Section, relocation, Mplink_compatible);
+    relocation = relocation->next;
+  }
+
+  /* update the rom with the patched idata sections */
+  if (FlagIsSet(Section->flags, STYP_DATA) && (Section->relocation_list.first != NULL)) {
+    assert(FlagIsSet(Section->next->flags, STYP_DATA_ROM));
+    _copy_rom_section(Object, Section, Section->next);
+  }
+
+  /* strip the relocations from the section */
+  gp_list_delete(&Section->relocation_list);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_patch_job(size_t Index, void *Context)
+{
+  patch_context_t *context = (patch_context_t *)Context;
+
+  gp_message_buffer_begin(&context->messages[Index]);
+  _patch_section(context->object, context->sections[Index], context->mplink_compatible);
+  gp_message_buffer_end();
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Patch all addresses with the relocated symbols. The relocations are
-   stripped from the sections. */
+   stripped from the sections.
+
+   Each section has its own data, so the sections are patched on Num_threads threads. The messages
+   of the sections are written afterwards in the order of the sections. */
 
 void
-gp_cofflink_patch(gp_object_t *Object, gp_boolean Mplink_compatible)
+gp_cofflink_patch(gp_object_t *Object, gp_boolean Mplink_compatible, unsigned int Num_threads)
 {
-  gp_section_t     *section;
-  const gp_reloc_t *relocation;
+  gp_section_t    *section;
+  patch_context_t  context;
+  size_t           num_sections;
+  size_t           i;
 
   gp_debug("Patching data with relocated symbols.");
 
-  section = Object->section_list.first;
-  while (section != NULL) {
-    if (gp_coffgen_section_has_data(section)) {
-      /* patch raw data with relocation entries */
-      relocation = section->relocation_list.first;
-      while (relocation != NULL) {
-        _patch_addr(Object, section, relocation, Mplink_compatible);
-        relocation = relocation->next;
+  if (Num_threads <= 1) {
+    section = Object->section_list.first;
+    while (section != NULL) {
+      if (gp_coffgen_section_has_data(section)) {
+        _patch_section(Object, section, Mplink_compatible);
       }
 
-      /* update the rom with the patched idata sections */
-      if (FlagIsSet(section->flags, STYP_DATA) && (section->relocation_list.first != NULL)) {
-        assert(FlagIsSet(section->next->flags, STYP_DATA_ROM));
-        _copy_rom_section(Object, section, section->next);
-      }
+      section = section->next;
+    }
+    return;
+  }
 
-      /* strip the relocations from the section */
-      gp_list_delete(&section->relocation_list);
+  context.sections = (gp_section_t **)GP_Malloc(Object->section_list.num_nodes * sizeof(gp_section_t *));
+  num_sections     = 0;
+  section          = Object->section_list.first;
+  while (section != NULL) {
+    if (gp_coffgen_section_has_data(section)) {
+      /* The ROM section of an idata section is written by the job of the idata section. */
+      assert(FlagIsClr(section->flags, STYP_DATA) || (section->relocation_list.first == NULL) ||
+             (section->next->relocation_list.first == NULL));
+      context.sections[num_sections] = section;
+      ++num_sections;
     }
 
     section = section->next;
   }
+
+  context.object            = Object;
+  context.messages          = (gp_message_buffer_t *)GP_Calloc(num_sections, sizeof(gp_message_buffer_t));
+  context.mplink_compatible = Mplink_compatible;
+
+  gp_thread_run(Num_threads, num_sections, _patch_job, &context);
+
+  for (i = 0; i < num_sections; ++i) {
+    gp_message_buffer_flush(&context.messages[i]);
+  }
+
+  free(context.messages);
+  free(context.sections);
 }
 
 /*------------------------------------------------------------------------------------------------*/
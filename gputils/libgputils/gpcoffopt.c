@@ -99,6 +99,19 @@ static unsigned int         num_registers;
 
 static gp_boolean           first_banksel = false;
 
+/* The removed instructions of the current section. The data of the section is compacted and the
+   moved sections are shifted only after the last relocation of the section. */
+static MemArea_t           *removed_areas;      /* On the addresses before the compaction, in increasing order. */
+static unsigned int         num_removed_areas;
+static unsigned int         max_removed_areas;
+static uint32_t            *removed_pages;      /* The page of each removed instruction at the time of removal. */
+static unsigned int         removed_byte_total;
+
+static uint32_t            *section_shift_array; /* Byte offset of data movement for each element of section_array. */
+
+/* The number of instructions removed by the optimizers, for the time report of gplink. */
+unsigned int                gp_coffopt_removed_insns = 0;
+
 /*------------------------------------------------------------------------------------------------*/
 
 /* Remove any weak symbols in the object. */
@@ -125,38 +138,55 @@ gp_coffopt_remove_weak(gp_object_t *Object)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Remove any relocatable section that doesn't have a symbol pointed to by a relocation. */
+/* Remove any relocatable section that can not be reached through the relocations from
+   an absolute or initialized data section. The reachable sections are marked by
+   gp_coffgen_check_relocations(), the rest is swept out in one pass. The removed
+   sections do not change the reachability of the remaining ones, but their relocations
+   are counted again without them. */
 
 void
 gp_coffopt_remove_dead_sections(gp_object_t *Object, int Pass, gp_boolean Enable_cinit_wanings)
 {
   gp_section_t *section;
   gp_section_t *section_next;
+  gp_symbol_t  *symbol;
+  gp_symbol_t  *symbol_next;
   gp_boolean    section_removed;
 
-  do {
-    section_removed = false;
-    gp_debug("Removing dead sections pass %i.", Pass);
-
-    gp_coffgen_check_relocations(Object, Enable_cinit_wanings);
-    section = Object->section_list.first;
-    while (section != NULL) {
-      section_next = section->next;
-
-      if (FlagIsClr(section->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
-        gp_debug("Removing section \"%s\".", section->name);
-        /* It is not allowed to deleted because the gplink/cod.c will need these. */
-        gp_coffgen_move_reserve_section_symbols(Object, section);
-        /* It is not allowed to deleted because the gplink/cod.c will need this. */
-        gp_coffgen_move_reserve_section(Object, section);
-        section_removed = true;
-      }
-      section = section_next;
+  gp_debug("Removing dead sections pass %i.", Pass);
+
+  gp_coffgen_check_relocations(Object, Enable_cinit_wanings);
+
+  /* It is not allowed to deleted the symbols because the gplink/cod.c will need these. */
+  symbol = Object->symbol_list.first;
+  while (symbol != NULL) {
+    symbol_next = symbol->next;
+
+    if ((symbol->section != NULL) && FlagIsClr(symbol->section->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
+      gp_coffgen_move_reserve_symbol(Object, symbol);
     }
+    symbol = symbol_next;
+  }
 
-    /* take another pass */
-    ++Pass;
-  } while (section_removed);
+  section_removed = false;
+  section = Object->section_list.first;
+  while (section != NULL) {
+    section_next = section->next;
+
+    if (FlagIsClr(section->opt_flags, OPT_FLAGS_PROTECTED_SECTION)) {
+      gp_debug("Removing section \"%s\".", section->name);
+      /* It is not allowed to deleted because the gplink/cod.c will need this. */
+      gp_coffgen_move_reserve_section(Object, section);
+      section_removed = true;
+    }
+    section = section_next;
+  }
+
+  if (section_removed) {
+    /* The Pagesel and Banksel removal read the relocation counters, these may count only
+       the relocations of the remaining sections. The warnings have already been given. */
+    gp_coffgen_check_relocations(Object, Enable_cinit_wanings | RELOC_DISABLE_WARN);
+  }
 }
 
 
@@ -382,6 +412,67 @@ _label_array_decrease_addresses(proc_class_t Class, gp_section_t *Section, uint3
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Translates an actual address of the current section to the address of its not yet compacted data. */
+
+static uint32_t
+_removed_areas_data_addr(uint32_t Byte_addr)
+{
+  const MemArea_t *last;
+  unsigned int     i;
+
+  if (num_removed_areas == 0) {
+    return Byte_addr;
+  }
+
+  /* In most cases the address is behind all the removed instructions. */
+  last = &removed_areas[num_removed_areas - 1];
+  if ((last->byte_address + last->byte_number) <= (Byte_addr + removed_byte_total)) {
+    return (Byte_addr + removed_byte_total);
+  }
+
+  for (i = 0; i < num_removed_areas; ++i) {
+    if (removed_areas[i].byte_address > Byte_addr) {
+      break;
+    }
+
+    Byte_addr += removed_areas[i].byte_number;
+  }
+
+  return Byte_addr;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Records a removed instruction of the current section. */
+
+static void
+_removed_areas_add(uint32_t Byte_addr, uint32_t Byte_length, uint32_t Page)
+{
+  unsigned int i;
+
+  if (num_removed_areas >= max_removed_areas) {
+    max_removed_areas = (max_removed_areas == 0) ? 64 : (max_removed_areas * 2);
+    removed_areas     = (MemArea_t *)GP_Realloc(removed_areas, max_removed_areas * sizeof(MemArea_t));
+    removed_pages     = (uint32_t *)GP_Realloc(removed_pages, max_removed_areas * sizeof(uint32_t));
+  }
+
+  /* The new one is usually the last one. */
+  i = num_removed_areas;
+  while ((i > 0) && (removed_areas[i - 1].byte_address > Byte_addr)) {
+    removed_areas[i] = removed_areas[i - 1];
+    removed_pages[i] = removed_pages[i - 1];
+    --i;
+  }
+
+  removed_areas[i].byte_address = Byte_addr;
+  removed_areas[i].byte_number  = Byte_length;
+  removed_pages[i]              = Page;
+  ++num_removed_areas;
+  removed_byte_total += Byte_length;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Decrease section addresses in a given list. */
 
 static void
@@ -408,7 +499,8 @@ _sections_decrease_start_address(proc_class_t Class, const gp_section_t *Section
       if (FlagIsClr(section->flags, STYP_ABS)) {
         byte_address = section->address - Byte_offset;
         insn_address = gp_processor_insn_from_byte_c(Class, byte_address);
-        gp_mem_b_move(section->data, section->address, byte_address, section->size);
+        /* The data will be moved by _removed_areas_apply(). */
+        section_shift_array[i] += Byte_offset;
         section->address = byte_address;
 
         symbol = section->symbol;
@@ -426,28 +518,96 @@ _sections_decrease_start_address(proc_class_t Class, const gp_section_t *Section
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Decrease line number addresses in a given list. */
+/* Decrease line number addresses after the removed instructions of a section. The line numbers
+   of the section are on the addresses before the compaction, End_address is the original end
+   of the section. */
 
 static void
-_linenum_decrease_addresses(proc_class_t Class, gp_section_t *First_section,
-                            uint32_t Relocation_page, uint32_t Start_address, uint32_t Byte_offset)
+_linenum_decrease_addresses(proc_class_t Class, gp_section_t *First_section, gp_section_t *Section,
+                            uint32_t End_address)
 {
-  gp_section_t *section;
-  gp_linenum_t *linenum;
+  gp_section_t    *section;
+  gp_linenum_t    *linenum;
+  gp_linenum_t    *next;
+  unsigned int     i;
+  uint32_t         prev_address;
+  uint32_t         offset;
+  uint32_t         page;
+  uint32_t         page_cached;
+  uint32_t         offset_cached;
+  gp_boolean       cached;
+
+  /* The line numbers of the removed instructions disappear, the others follow their instruction
+     on the same page. The line numbers are usually in increasing order, so the areas are walked
+     only once. */
+  i            = 0;
+  offset       = 0;
+  page         = 0;
+  prev_address = 0;
+  linenum      = Section->line_number_list.first;
+  while (linenum != NULL) {
+    next = linenum->next;
+
+    if (linenum->address < prev_address) {
+      i      = 0;
+      offset = 0;
+    }
+    prev_address = linenum->address;
+
+    while ((i < num_removed_areas) &&
+           ((removed_areas[i].byte_address + removed_areas[i].byte_number) <= linenum->address)) {
+      /* The offset counts only the areas on the page of last one. */
+      if ((offset == 0) || (removed_pages[i] != page)) {
+        page   = removed_pages[i];
+        offset = 0;
+      }
+      offset += removed_areas[i].byte_number;
+      ++i;
+    }
+
+    if ((i < num_removed_areas) && (removed_areas[i].byte_address <= linenum->address)) {
+      gp_coffgen_del_linenum(Section, linenum);
+    }
+    else if ((offset > 0) && (_page_addr_from_byte_addr(Class, linenum->address - offset) == page)) {
+      linenum->address -= offset;
+    }
+
+    linenum = next;
+  }
+
+  gp_coffgen_invalidate_linenum_index(Section);
 
-  section = First_section;
+  /* The line numbers of the moved sections. */
+  page_cached   = 0;
+  offset_cached = 0;
+  cached        = false;
+  section       = First_section;
   while (section != NULL) {
     /* We must not modify an absolute section. */
-    if (FlagIsClr(section->flags, STYP_ABS)) {
+    if ((section != Section) && FlagIsClr(section->flags, STYP_ABS)) {
       linenum = section->line_number_list.first;
       while (linenum != NULL) {
-        /* Prevents the modification of linenumbers on other pages. */
-        if ((_page_addr_from_byte_addr(Class, linenum->address) == Relocation_page) &&
-            (linenum->address >= Start_address)) {
-          linenum->address -= Byte_offset;
+        if (linenum->address >= End_address) {
+          /* Prevents the modification of linenumbers on other pages. */
+          page = _page_addr_from_byte_addr(Class, linenum->address);
+
+          if ((!cached) || (page != page_cached)) {
+            page_cached   = page;
+            offset_cached = 0;
+            cached        = true;
+            for (i = 0; i < num_removed_areas; ++i) {
+              if (removed_pages[i] == page) {
+                offset_cached += removed_areas[i].byte_number;
+              }
+            }
+          }
+
+          linenum->address -= offset_cached;
         }
         linenum = linenum->next;
       }
+
+      gp_coffgen_invalidate_linenum_index(section);
     }
     section = section->next;
   }
@@ -455,14 +615,67 @@ _linenum_decrease_addresses(proc_class_t Class, gp_section_t *First_section,
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Applies the recorded removals of a section to its data, to the data of the moved sections and
+   to the line numbers. */
+
+static void
+_removed_areas_apply(proc_class_t Class, gp_section_t *First_section, gp_section_t *Section)
+{
+  gp_section_t *section;
+  unsigned int  i;
+
+  if (num_removed_areas == 0) {
+    return;
+  }
+
+  _linenum_decrease_addresses(Class, First_section, Section,
+                              Section->address + Section->size + removed_byte_total);
+
+  gp_mem_b_delete_areas(Section->data, removed_areas, num_removed_areas);
+
+  for (i = 0; i < num_sections; ++i) {
+    if (section_shift_array[i] != 0) {
+      section = section_array[i];
+      gp_mem_b_move(section->data, section->address + section_shift_array[i], section->address, section->size);
+      section_shift_array[i] = 0;
+    }
+  }
+
+  num_removed_areas  = 0;
+  removed_byte_total = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Frees the record of the removed instructions. */
+
+static void
+_removed_areas_free(void)
+{
+  if (removed_areas != NULL) {
+    free(removed_areas);
+    free(removed_pages);
+    removed_areas = NULL;
+    removed_pages = NULL;
+  }
+
+  num_removed_areas  = 0;
+  max_removed_areas  = 0;
+  removed_byte_total = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* Destroys an instruction from data memory of given section. */
 
 static void
 _destroy_insn(proc_class_t Class, gp_section_t *Section, uint32_t Byte_address, uint32_t Byte_length,
               const char *Symbol_name)
 {
-  gp_mem_b_delete_area(Section->data, Byte_address, Byte_length);
+  _removed_areas_add(_removed_areas_data_addr(Byte_address), Byte_length,
+                     _page_addr_from_byte_addr(Class, Byte_address));
   Section->size -= Byte_length;
+  ++gp_coffopt_removed_insns;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -479,24 +692,20 @@ _destroy_insn_and_update_addr(proc_class_t Class, gp_section_t *First_section, g
   uint32_t      byte_length_curr;
   uint32_t      insn_addr_curr;
   uint32_t      insn_length_curr;
-  uint32_t      byte_addr_next;
   const char   *sym_name;
 
   byte_addr_curr   = reloc_pipe[Insn_index].reloc_byte_addr;
   byte_length_curr = reloc_pipe[Insn_index].reloc_byte_length;
   insn_addr_curr   = reloc_pipe[Insn_index].reloc_insn_addr;
   insn_length_curr = reloc_pipe[Insn_index].reloc_insn_length;
-  byte_addr_next   = byte_addr_curr + byte_length_curr;
   start_page       = reloc_pipe[Insn_index].reloc_page;
   sym_name         = (reloc_pipe[Insn_index].relocation->symbol != NULL) ?
                                         reloc_pipe[Insn_index].relocation->symbol->name : NULL;
 
+  /* The line numbers are updated together by _removed_areas_apply(). */
   _destroy_insn(Class, Section, byte_addr_curr, byte_length_curr, sym_name);
   gp_symbol_delete_by_value(Section->label_array, &Section->num_labels, insn_addr_curr);
 
-  gp_coffgen_del_linenum_by_address_area(Section, byte_addr_curr, byte_addr_next - 1);
-  _linenum_decrease_addresses(Class, First_section, start_page, byte_addr_next, byte_length_curr);
-
   /* Enable modification of address only in program memory. */
   _label_clear_opt_flag();
 
@@ -528,7 +737,7 @@ _insn_isReturn(proc_class_t Class, const gp_section_t *Section, unsigned int Byt
     return false;
   }
 
-  if (Class->i_memory_get(Section->data, Byte_addr, &data, NULL, NULL) != W_USED_ALL) {
+  if (Class->i_memory_get(Section->data, _removed_areas_data_addr(Byte_addr), &data, NULL, NULL) != W_USED_ALL) {
     return false;
   }
 
@@ -572,7 +781,8 @@ _pagesel_reloc_analyze(proc_class_t Class, gp_section_t *Section, gp_reloc_t *Re
   reloc_byte_addr = Section->address        + Relocation->address;
   value           = (uint32_t)symbol->value + Relocation->offset;
 
-  if (Class->i_memory_get(Section->data, reloc_byte_addr, &data, NULL, NULL) != W_USED_ALL) {
+  if (Class->i_memory_get(Section->data, _removed_areas_data_addr(reloc_byte_addr), &data, NULL, NULL) !=
+      W_USED_ALL) {
     gp_error("No instruction at 0x%0*X in program memory!", Class->addr_digits, reloc_byte_addr);
     assert(0);
   }
@@ -930,6 +1140,7 @@ gp_coffopt_remove_unnecessary_pagesel(gp_object_t *Object)
       section_array = gp_coffgen_make_section_array(Object, &num_sections,
                               gp_processor_page_addr(class, gp_processor_insn_from_byte_c(class, section->address)),
                               STYP_ROM_AREA);
+      section_shift_array = (section_array != NULL) ? (uint32_t *)GP_Calloc(num_sections, sizeof(uint32_t)) : NULL;
       _label_arrays_make(class);
 
       if (section->label_array != NULL) {
@@ -947,15 +1158,19 @@ gp_coffopt_remove_unnecessary_pagesel(gp_object_t *Object)
         }
       }
 
+      _removed_areas_apply(class, first_section, section);
       _label_arrays_free();
 
       if (section_array != NULL) {
         free(section_array);
+        free(section_shift_array);
       }
     }
 
     section = section->next;
   } /* while (section != NULL) */
+
+  _removed_areas_free();
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -984,7 +1199,8 @@ _banksel_reloc_analyze(proc_class_t Class, pic_processor_t Processor, gp_section
 
   reloc_page      = gp_processor_page_addr(Class, reloc_insn_addr);
 
-  if (Class->i_memory_get(Section->data, reloc_byte_addr, &data, NULL, NULL) != W_USED_ALL) {
+  if (Class->i_memory_get(Section->data, _removed_areas_data_addr(reloc_byte_addr), &data, NULL, NULL) !=
+      W_USED_ALL) {
     gp_error("No instruction at 0x%0*X in program memory!", Class->addr_digits, reloc_byte_addr);
     assert(0);
   }
@@ -1205,6 +1421,7 @@ gp_coffopt_remove_unnecessary_banksel(gp_object_t *Object)
       section_array = gp_coffgen_make_section_array(Object, &num_sections,
                               gp_processor_page_addr(class, gp_processor_insn_from_byte_c(class, section->address)),
                               STYP_ROM_AREA);
+      section_shift_array = (section_array != NULL) ? (uint32_t *)GP_Calloc(num_sections, sizeof(uint32_t)) : NULL;
       _label_arrays_make(class);
       reloc_curr = section->relocation_list.first;
       if (reloc_curr != NULL) {
@@ -1223,16 +1440,19 @@ gp_coffopt_remove_unnecessary_banksel(gp_object_t *Object)
 
       }
 
+      _removed_areas_apply(class, first_section, section);
       _label_arrays_free();
 
       if (section_array != NULL) {
         free(section_array);
+        free(section_shift_array);
       }
     } /* if (gp_coffgen_section_has_data(section)) */
 
     section = section->next;
   } /* while (section != NULL) */
 
+  _removed_areas_free();
   free(register_array);
 }
 
@@ -1303,8 +1523,25 @@ struct _removal_s {
   uint32_t      page;		/* page of instruction address (used in sections only) */
   uint32_t      state;		/* state of the element */
   uint32_t      naddr;		/* type section: new address (pagesel code only) */
+  uint32_t      order;		/* creation order of the element */
 };
 
+/* a section moved by the removal, in initial byte addresses */
+typedef struct {
+  uint32_t      start;		/* start address of the section */
+  uint32_t      end;		/* address after the section */
+  unsigned int  shift;		/* shift of the section start */
+  size_t        first;		/* index of the first removed instruction of the section */
+  size_t        num;		/* number of removed instructions in the section */
+} _removal_range_t;
+
+/* a removed instruction, in initial byte addresses */
+typedef struct {
+  uint32_t      address;	/* address of the instruction */
+  unsigned int  length;		/* length of the instruction */
+  unsigned int  shift;		/* shift of the addresses after this instruction */
+} _removal_cut_t;
+
 /* function that inserts a relocation in the list */
 typedef gp_boolean _removal_add_reloc_t(gp_section_t *Section, gp_reloc_t *Reloc);
 
@@ -1312,6 +1549,20 @@ typedef gp_boolean _removal_add_reloc_t(gp_section_t *Section, gp_reloc_t *Reloc
 typedef gp_boolean _removal_check_state_t(_removal_t *Ptr);
 
 static _removal_t      *_removal_list;		/* the list of elements */
+static _removal_t     **_removal_array;		/* the elements in creation order, until they are listed */
+static size_t           _removal_num;		/* number of elements in the array */
+static size_t           _removal_max;		/* allocated size of the array */
+static _removal_t     **_removal_sections;	/* the section elements in list order */
+static size_t           _removal_num_sections;	/* number of section elements */
+static _removal_t     **_removal_labels;	/* hash table of the label elements by address */
+static size_t           _removal_labels_size;	/* size of the hash table (power of 2) */
+static size_t           _removal_num_labels;	/* number of label elements */
+static _removal_range_t *_removal_ranges;	/* the moved sections */
+static size_t           _removal_num_ranges;	/* number of moved sections */
+static size_t           _removal_max_ranges;	/* allocated size of the moved sections */
+static _removal_cut_t  *_removal_cuts;		/* the removed instructions of the moved sections */
+static size_t           _removal_num_cuts;	/* number of removed instructions */
+static size_t           _removal_max_cuts;	/* allocated size of the removed instructions */
 static gp_object_t     *_removal_object;	/* the object being processed */
 static proc_class_t     _removal_class;		/* the processor class */
 static pic_processor_t  _removal_processor;	/* the processor type */
@@ -1343,7 +1594,7 @@ _removal_free_list(void)
 /* Compare an element with an address and type. */
 /* Return -1 (lesser), 0 (equal) or 1 (greater). */
 static int
-_removal_compare(_removal_t *Ptr, uint32_t Address, uint16_t Type)
+_removal_compare(const _removal_t *Ptr, uint32_t Address, uint16_t Type)
 {
   assert(Ptr != NULL);
   if (Ptr->address < Address) {
@@ -1365,37 +1616,132 @@ _removal_compare(_removal_t *Ptr, uint32_t Address, uint16_t Type)
   return 0;
 }
 
-/* Find an element in the list. */
+/* Compare two elements by address, type and creation order (qsort). */
+static int
+_removal_order_cmp(const void *P0, const void *P1)
+{
+  const _removal_t *r0 = *(const _removal_t * const *)P0;
+  const _removal_t *r1 = *(const _removal_t * const *)P1;
+  int               res;
+
+  res = _removal_compare(r0, r1->address, r1->type);
+  if (res != 0) {
+    return res;
+  }
+
+  return (r0->order < r1->order) ? -1 : ((r0->order > r1->order) ? 1 : 0);
+}
+
+/* Sort the elements into the order of the list. */
+/* Equal elements are ordered as if each one had been inserted after the first equal one: */
+/* the first created element leads the group, the others follow in reverse creation order. */
+static void
+_removal_sort(_removal_t **Array, size_t Num)
+{
+  size_t      start;
+  size_t      end;
+  size_t      i;
+  size_t      j;
+  _removal_t *tmp;
+
+  if (Num < 2) {
+    return;
+  }
+
+  qsort(Array, Num, sizeof(_removal_t *), _removal_order_cmp);
+
+  for (start = 0; start < Num; start = end) {
+    end = start + 1;
+    while ((end < Num) && (_removal_compare(Array[end], Array[start]->address, Array[start]->type) == 0)) {
+      ++end;
+    }
+
+    /* reverse all but the first element of the group */
+    for (i = start + 1, j = end - 1; i < j; ++i, --j) {
+      tmp = Array[i];
+      Array[i] = Array[j];
+      Array[j] = tmp;
+    }
+  }
+}
+
+/* Hash of a label address. */
+static size_t
+_removal_label_hash(uint32_t Address)
+{
+  return (size_t)(Address * 2654435761u);
+}
+
+/* Find a label in the hash table. */
 /* Return the element if found, NULL otherwise. */
 static _removal_t*
-_removal_find_in_list(uint32_t Address, uint16_t Type)
+_removal_find_label(uint32_t Address)
 {
-  _removal_t *ptr;
-  int         res;
+  size_t mask;
+  size_t i;
 
-  if (_removal_list == NULL) {
+  if (_removal_labels == NULL) {
     return NULL;
   }
 
-  ptr = _removal_list;
-  while (((res = _removal_compare(ptr, Address, Type)) < 0) && (ptr->next != _removal_list)) {
-    ptr = ptr->next;
+  mask = _removal_labels_size - 1;
+  for (i = _removal_label_hash(Address) & mask; _removal_labels[i] != NULL; i = (i + 1) & mask) {
+    if (_removal_labels[i]->address == Address) {
+      return _removal_labels[i];
+    }
   }
 
-  return (res == 0) ? ptr : NULL;
+  return NULL;
 }
 
-/* Create a new element and insert it into the list. */
+/* Put a new label into the hash table, which is kept at most half full. */
+static void
+_removal_put_label(_removal_t *Ptr)
+{
+  _removal_t **old;
+  size_t       old_size;
+  size_t       mask;
+  size_t       i;
+  size_t       j;
+
+  if (((_removal_num_labels + 1) * 2) > _removal_labels_size) {
+    old = _removal_labels;
+    old_size = _removal_labels_size;
+    _removal_labels_size = (old_size == 0) ? 256 : (old_size * 2);
+    _removal_labels = (_removal_t **)GP_Calloc(_removal_labels_size, sizeof(_removal_t *));
+    _removal_num_labels = 0;
+
+    for (j = 0; j < old_size; ++j) {
+      if (old[j] != NULL) {
+        _removal_put_label(old[j]);
+      }
+    }
+
+    if (old != NULL) {
+      free(old);
+    }
+  }
+
+  mask = _removal_labels_size - 1;
+  for (i = _removal_label_hash(Ptr->address) & mask; _removal_labels[i] != NULL; i = (i + 1) & mask) {
+    ;
+  }
+
+  _removal_labels[i] = Ptr;
+  ++_removal_num_labels;
+}
+
+/* Create a new element. It is linked into the list by _removal_link_list(). */
 static _removal_t*
 _removal_add_to_list(uint32_t Address, uint16_t Type)
 {
-  _removal_t *pos;
   _removal_t *ptr;
-  int         res;
 
   /* create the new element */
   ptr = (_removal_t *)GP_Malloc(sizeof(_removal_t));
   assert(ptr != NULL);
+  ptr->prev = NULL;
+  ptr->next = NULL;
   ptr->relocation = NULL;
   ptr->section = NULL;
   ptr->symbol = NULL;
@@ -1405,37 +1751,99 @@ _removal_add_to_list(uint32_t Address, uint16_t Type)
   ptr->length = 2;	/* default instruction length */
   ptr->address = Address;
   ptr->state = REMOVAL_STATE_UNDEF;
+  ptr->order = (uint32_t)_removal_num;
 
-  if (_removal_list == NULL) {
-    _removal_list = ptr;
-    ptr->prev = ptr;
-    ptr->next = ptr;
-    return ptr;
+  if (_removal_num >= _removal_max) {
+    _removal_max = (_removal_max == 0) ? 256 : (_removal_max * 2);
+    _removal_array = (_removal_t **)GP_Realloc(_removal_array, _removal_max * sizeof(_removal_t *));
   }
 
-  pos = _removal_list;
-  while (((res = _removal_compare(pos, Address, Type)) < 0) && (pos->next != _removal_list)) {
-    pos = pos->next;
+  _removal_array[_removal_num++] = ptr;
+  return ptr;
+}
+
+/* Collect the section elements in list order, after all of them have been created. */
+static void
+_removal_index_sections(void)
+{
+  size_t i;
+
+  _removal_sections = (_removal_t **)GP_Malloc(_removal_num * sizeof(_removal_t *));
+  _removal_num_sections = 0;
+  for (i = 0; i < _removal_num; ++i) {
+    if (_removal_array[i]->type == REMOVAL_TYPE_SECTION) {
+      _removal_sections[_removal_num_sections++] = _removal_array[i];
+    }
   }
 
-  if (res > 0) {
-    /* insert ptr before pos */
-    ptr->prev = pos->prev;
-    ptr->next = pos;
-    /* ptr becomes the first item in the list */
-    if (pos == _removal_list) {
-      _removal_list = ptr;
+  _removal_sort(_removal_sections, _removal_num_sections);
+}
+
+/* Find the section element which precedes the element in the circular list. */
+static _removal_t*
+_removal_find_section(const _removal_t *Ptr)
+{
+  size_t lo;
+  size_t hi;
+  size_t mid;
+
+  assert(_removal_num_sections > 0);
+  assert(Ptr->type != REMOVAL_TYPE_SECTION);
+
+  /* the number of sections which are lesser than the element */
+  lo = 0;
+  hi = _removal_num_sections;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (_removal_compare(_removal_sections[mid], Ptr->address, Ptr->type) < 0) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
     }
   }
-  else {
-    /* insert ptr after pos */
-    ptr->prev = pos;
-    ptr->next = pos->next;
+
+  /* without a lesser section the search wraps around to the last one */
+  return _removal_sections[((lo > 0) ? lo : _removal_num_sections) - 1];
+}
+
+/* Sort all elements and link them into the circular list. */
+static void
+_removal_link_list(void)
+{
+  size_t i;
+
+  _removal_list = NULL;
+  if (_removal_num > 0) {
+    _removal_sort(_removal_array, _removal_num);
+    for (i = 0; i < _removal_num; ++i) {
+      _removal_array[i]->prev = _removal_array[(i + _removal_num - 1) % _removal_num];
+      _removal_array[i]->next = _removal_array[(i + 1) % _removal_num];
+    }
+    _removal_list = _removal_array[0];
   }
 
-  ptr->prev->next = ptr;
-  ptr->next->prev = ptr;
-  return ptr;
+  /* the list does not need the indexes */
+  if (_removal_array != NULL) {
+    free(_removal_array);
+  }
+
+  if (_removal_sections != NULL) {
+    free(_removal_sections);
+  }
+
+  if (_removal_labels != NULL) {
+    free(_removal_labels);
+  }
+
+  _removal_array = NULL;
+  _removal_num = 0;
+  _removal_max = 0;
+  _removal_sections = NULL;
+  _removal_num_sections = 0;
+  _removal_labels = NULL;
+  _removal_labels_size = 0;
+  _removal_num_labels = 0;
 }
 
 /* Append a new section to the list. */
@@ -1460,7 +1868,7 @@ _removal_add_label(gp_symbol_t *Symbol, _removal_t *Source)
   _removal_t *ptr;
 
   /* Locate the label if it already exists */
-  ptr = _removal_find_in_list(Symbol->value, REMOVAL_TYPE_LABEL);
+  ptr = _removal_find_label(Symbol->value);
 
   /* label not found: append a new one */
   if (ptr == NULL) {
@@ -1469,6 +1877,7 @@ _removal_add_label(gp_symbol_t *Symbol, _removal_t *Source)
     /* create the new element */
     ptr = _removal_add_to_list(Symbol->value, REMOVAL_TYPE_LABEL);
     ptr->symbol = Symbol;
+    _removal_put_label(ptr);
   }
 
   /* link the source to the label */
@@ -1546,11 +1955,14 @@ _removal_prepare_list(_removal_add_reloc_t *Add_reloc_ptr)
     section = section->next;
   }
 
-  if (_removal_list == NULL) {
+  if (_removal_num == 0) {
     gp_debug ("  No relocatable ROM sections found.");
+    _removal_link_list();
     return false;
   }
 
+  _removal_index_sections();
+
   /* Second pass: identify relocations */
   section = _removal_object->section_list.first;
   while (section != NULL) {
@@ -1633,6 +2045,8 @@ _removal_prepare_list(_removal_add_reloc_t *Add_reloc_ptr)
     section = section->next;
   }
 
+  _removal_link_list();
+
   if (!ret)
     /* Free the relocations list. */
     _removal_free_list();
@@ -1716,58 +2130,165 @@ _removal_process_list (_removal_check_state_t *Check_state_ptr)
   return false;
 }
 
-/* Update symbols and line numbers. */
+/* Find the shift of an address of a moved section. */
+/* If Whole is true, only the removed instructions which end at or before the address count, */
+/* otherwise all which start before the address. */
+static unsigned int
+_removal_shift_at(const _removal_range_t *Range, uint32_t Address, gp_boolean Whole)
+{
+  const _removal_cut_t *cuts;
+  size_t                lo;
+  size_t                hi;
+  size_t                mid;
+
+  /* the number of removed instructions before the address */
+  cuts = &_removal_cuts[Range->first];
+  lo = 0;
+  hi = Range->num;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if ((Whole) ? ((cuts[mid].address + cuts[mid].length) <= Address) : (cuts[mid].address < Address)) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+
+  return ((lo > 0) ? cuts[lo - 1].shift : Range->shift);
+}
+
+/* Find the removed instruction which contains an address of a moved section. */
+static const _removal_cut_t*
+_removal_cut_at(const _removal_range_t *Range, uint32_t Address)
+{
+  const _removal_cut_t *cuts;
+  size_t                lo;
+  size_t                hi;
+  size_t                mid;
+
+  cuts = &_removal_cuts[Range->first];
+  lo = 0;
+  hi = Range->num;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (cuts[mid].address <= Address) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+
+  if ((lo > 0) && (Address < (cuts[lo - 1].address + cuts[lo - 1].length))) {
+    return &cuts[lo - 1];
+  }
+
+  return NULL;
+}
+
+/* Update the line numbers of a moved section. */
 static void
-_removal_update(gp_section_t *Section, unsigned int Shift, uint32_t Start_address, uint32_t End_address)
+_removal_update_linenums(gp_section_t *Section, const _removal_range_t *Range)
 {
   gp_linenum_t *linenum;
-  gp_symbol_t  *symbol;
-
-  if (Shift == 0)
-    return;
+  gp_linenum_t *next;
+  unsigned int  shift;
 
-  /* update line numbers */
   linenum = Section->line_number_list.first;
   while (linenum != NULL) {
-    if ((linenum->address >= Start_address) && (linenum->address < End_address)) {
-      gp_debug("    Changing linenumber %u (section:%s from:%#lx to:%#lx)",
-    	linenum->line_number, Section->name, linenum->address, linenum->address - Shift);
-      linenum->address -= Shift;
+    next = linenum->next;
+    if ((linenum->address >= Range->start) && (linenum->address < Range->end)) {
+      if (_removal_cut_at(Range, linenum->address) != NULL) {
+        gp_debug("    Removing linenumber %u (section:%s addr:%#lx)",
+                 linenum->line_number, Section->name, linenum->address);
+        gp_coffgen_del_linenum(Section, linenum);
+      }
+      else if ((shift = _removal_shift_at(Range, linenum->address, true)) != 0) {
+        gp_debug("    Changing linenumber %u (section:%s from:%#lx to:%#lx)",
+                 linenum->line_number, Section->name, linenum->address, linenum->address - shift);
+        linenum->address -= shift;
+      }
     }
-    linenum = linenum->next;
+    linenum = next;
+  }
+
+  gp_coffgen_invalidate_linenum_index(Section);
+}
+
+/* Update the symbols of all moved sections. */
+static void
+_removal_update_symbols(void)
+{
+  gp_symbol_t            *symbol;
+  const _removal_range_t *range;
+  uint32_t                addr;
+  unsigned int            shift;
+  size_t                  lo;
+  size_t                  hi;
+  size_t                  mid;
+
+  if (_removal_num_ranges == 0) {
+    return;
   }
 
-  /* update symbols */
-  Shift = gp_processor_insn_from_byte_c(_removal_class, Shift);
-  Start_address = gp_processor_insn_from_byte_c(_removal_class, Start_address);
-  End_address = gp_processor_insn_from_byte_c(_removal_class, End_address);
   symbol = _removal_object->symbol_list.first;
   while (symbol != NULL) {
-    if (FlagIsSet(symbol->opt_flags, OPT_FLAGS_GPCOFFOPT_REMOVAL_SYMBOL_VALID)
-        && (symbol->value >= Start_address) && (symbol->value < End_address)) {
-      gp_debug("    Changing symbol %s (section:%s from:%#lx to:%#lx)",
-    	symbol->name, symbol->section_name, symbol->value, symbol->value - Shift);
-      symbol->value -= Shift;
-      /* done with this symbol */
-      FlagClr(symbol->opt_flags, OPT_FLAGS_GPCOFFOPT_REMOVAL_SYMBOL_VALID);
+    if (FlagIsSet(symbol->opt_flags, OPT_FLAGS_GPCOFFOPT_REMOVAL_SYMBOL_VALID)) {
+      addr = gp_processor_byte_from_insn_c(_removal_class, symbol->value);
+
+      /* the number of ranges which start at or before the symbol */
+      lo = 0;
+      hi = _removal_num_ranges;
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (_removal_ranges[mid].start <= addr) {
+          lo = mid + 1;
+        }
+        else {
+          hi = mid;
+        }
+      }
+
+      if (lo > 0) {
+        range = &_removal_ranges[lo - 1];
+        if ((addr < range->end) && ((shift = _removal_shift_at(range, addr, true)) != 0)) {
+          shift = gp_processor_insn_from_byte_c(_removal_class, shift);
+          gp_debug("    Changing symbol %s (section:%s from:%#lx to:%#lx)",
+                   symbol->name, symbol->section_name, symbol->value, symbol->value - shift);
+          symbol->value -= shift;
+          /* done with this symbol */
+          FlagClr(symbol->opt_flags, OPT_FLAGS_GPCOFFOPT_REMOVAL_SYMBOL_VALID);
+        }
+      }
     }
     symbol = symbol->next;
   }
-
 }
 
 /* Update a section and return the new shift value. */
+/* The removed instructions are deleted in one pass, the other addresses of the section are */
+/* rebased by the shifts recorded for them. The symbols are updated after the last section. */
 static unsigned int
 _removal_update_section (_removal_t *Ptr, unsigned int Shift, unsigned int Byte_count, unsigned int Insn_count)
 {
-  gp_section_t *section;
-  uint32_t      isaddr;
-  uint32_t      inaddr;
-  uint32_t      csaddr;
-  uint32_t      saddr;
-  uint32_t      spage;
-  uint32_t      eaddr;
-  uint32_t      epage;
+  gp_section_t     *section;
+  _removal_range_t *range;
+  _removal_t       *ptr;
+  gp_reloc_t      **relocs;
+  MemArea_t        *areas;
+  gp_reloc_t       *reloc;
+  uint32_t          isaddr;
+  uint32_t          inaddr;
+  uint32_t          saddr;
+  uint32_t          spage;
+  uint32_t          eaddr;
+  uint32_t          epage;
+  uint32_t          rbsaddr;
+  unsigned int      rshift;
+  unsigned int      total;
+  unsigned int      i;
+  uint16_t          dummy;
 
   section = Ptr->section;
   /* initial byte start address of the section */
@@ -1793,89 +2314,113 @@ _removal_update_section (_removal_t *Ptr, unsigned int Shift, unsigned int Byte_
     eaddr = gp_processor_insn_from_byte_c(_removal_class, isaddr - Shift + section->size - Byte_count - 2);
   }
 
-  /* now move the section */
-  if (Shift != 0) {
-    /* move section data and update its address and size */
-    gp_debug("    Moving section %s (from:%#lx to:%#lx size:%lu)",
-             section->name, isaddr, isaddr - Shift, section->size);
-    gp_mem_b_move(section->data, isaddr, isaddr - Shift, section->size);
-    section->address -= Shift;
-    section->shadow_address -= Shift;
+  /* record the shifts of the section */
+  if (_removal_num_ranges >= _removal_max_ranges) {
+    _removal_max_ranges = (_removal_max_ranges == 0) ? 64 : (_removal_max_ranges * 2);
+    _removal_ranges = (_removal_range_t *)GP_Realloc(_removal_ranges, _removal_max_ranges * sizeof(_removal_range_t));
   }
 
-  /* current byte start address for symbol and line number updates */
-  csaddr = isaddr;
-
-  /* now remove the instructions inside the section */
-  while (Insn_count-- > 0) {
+  range = &_removal_ranges[_removal_num_ranges];
+  range->start = isaddr;
+  range->end   = inaddr;
+  range->shift = Shift;
+  range->first = _removal_num_cuts;
+  range->num   = 0;
 
-    uint32_t    rbsaddr;	/* relocation byte start address */
-    uint32_t    rbshift;	/* relocation byte shift */
-    uint32_t    rbnaddr;	/* relocation byte next address */
-    uint32_t    risaddr;	/* relocation instruction start address */
-    uint32_t    rishift;	/* relocation instruction shift */
-    uint16_t    dummy;
-    gp_reloc_t *reloc;
+  areas  = NULL;
+  relocs = NULL;
+  if (Insn_count > 0) {
+    areas  = (MemArea_t *)GP_Malloc(Insn_count * sizeof(MemArea_t));
+    relocs = (gp_reloc_t **)GP_Malloc(Insn_count * sizeof(gp_reloc_t *));
+  }
 
+  /* collect the instructions to remove, in increasing address order */
+  total = 0;
+  ptr   = Ptr;
+  for (i = 0; i < Insn_count; ++i) {
     /* point to the next instruction to remove */
     do
-      Ptr = Ptr->next;
-    while ((Ptr->flags & REMOVAL_FLAG_REMOVE) == 0);
-    assert(Ptr->section == section);
+      ptr = ptr->next;
+    while ((ptr->flags & REMOVAL_FLAG_REMOVE) == 0);
+    assert(ptr->section == section);
 
     /* byte address of instruction to remove */
-    rbsaddr = section->address + Ptr->relocation->address;
-    /* number of bytes to remove */
-    rbshift = Ptr->length;
-    /* instruction address of instruction to remove */
-    risaddr = gp_processor_insn_from_byte_c(_removal_class, rbsaddr);
-    /* number of instructions to remove */
-    rishift = gp_processor_insn_from_byte_c(_removal_class, rbshift);
-    /* byte address after the instruction to remove */
-    rbnaddr = rbsaddr + rbshift;
-
-    gp_debug("    Removing instruction %#lx (addr:%#lx:%lu insn:%#lx:%lu next:%#lx)", Ptr->address,
-             rbsaddr, rbshift, risaddr, rishift, rbnaddr);
+    rbsaddr = isaddr + ptr->relocation->address;
+
+    gp_debug("    Removing instruction %#lx (addr:%#lx:%u)", ptr->address, rbsaddr, ptr->length);
 
     if (_removal_class->i_memory_get(section->data, rbsaddr, &dummy, NULL, NULL) != W_USED_ALL) {
       gp_error("No instruction at 0x%0*X in program memory!", _removal_class->addr_digits, rbsaddr);
       assert(0);
     }
 
-    /* remove the instruction */
-    gp_debug("    Changing size of section %s (addr:%#lx from:%lu to:%lu)",
-             section->name, section->address, section->size, section->size - rbshift);
-    gp_mem_b_delete_area(section->data, rbsaddr, rbshift);
-    section->size -= rbshift;
+    total += ptr->length;
+    areas[i].byte_address = rbsaddr - Shift;
+    areas[i].byte_number  = ptr->length;
+    relocs[i] = ptr->relocation;
+
+    if (_removal_num_cuts >= _removal_max_cuts) {
+      _removal_max_cuts = (_removal_max_cuts == 0) ? 256 : (_removal_max_cuts * 2);
+      _removal_cuts = (_removal_cut_t *)GP_Realloc(_removal_cuts, _removal_max_cuts * sizeof(_removal_cut_t));
+    }
+
+    _removal_cuts[_removal_num_cuts].address = rbsaddr;
+    _removal_cuts[_removal_num_cuts].length  = ptr->length;
+    _removal_cuts[_removal_num_cuts].shift   = Shift + total;
+    ++_removal_num_cuts;
+    ++range->num;
+  }
+
+  /* empty sections hold no address */
+  if (inaddr > isaddr) {
+    ++_removal_num_ranges;
+  }
+
+  /* now move the section */
+  if (Shift != 0) {
+    /* move section data and update its address and size */
+    gp_debug("    Moving section %s (from:%#lx to:%#lx size:%lu)",
+             section->name, isaddr, isaddr - Shift, section->size);
+    gp_mem_b_move(section->data, isaddr, isaddr - Shift, section->size);
+    section->address -= Shift;
+    section->shadow_address -= Shift;
+  }
 
-    /* remove the line number */
-    gp_coffgen_del_linenum_by_address_area(section, rbsaddr, rbnaddr - 1);
+  if (Insn_count > 0) {
+    /* remove the instructions */
+    gp_debug("    Changing size of section %s (addr:%#lx from:%lu to:%lu)",
+             section->name, section->address, section->size, section->size - total);
+    gp_mem_b_delete_areas(section->data, areas, Insn_count);
+    section->size -= total;
 
-    /* update following relocation addresses in current section */
+    /* update the relocation addresses which follow a removed instruction */
     reloc = section->relocation_list.first;
     while (reloc != NULL) {
-      if (reloc->address > Ptr->relocation->address) {
+      rshift = _removal_shift_at(range, isaddr + reloc->address, false) - Shift;
+      if (rshift != 0) {
         gp_debug("    Changing relocation address (section:%s symbol:%s from:%#lx to:%#lx)",
-          	 reloc->symbol->section_name, reloc->symbol->name, reloc->address, reloc->address - rbshift);
-        reloc->address -= rbshift;
+                 reloc->symbol->section_name, reloc->symbol->name, reloc->address, reloc->address - rshift);
+        reloc->address -= rshift;
       }
       reloc = reloc->next;
     }
 
-    /* update symbols and line numbers */
-    isaddr += rbshift;
-    _removal_update(section, Shift, csaddr, isaddr + Ptr->relocation->address);
-    csaddr = isaddr + Ptr->relocation->address;
-    Shift += rbshift;
+    /* remove the relocations */
+    for (i = 0; i < Insn_count; ++i) {
+      gp_coffgen_del_reloc(section, relocs[i]);
+    }
 
-    /* remove the relocation */
-    gp_coffgen_del_reloc(section, Ptr->relocation);
+    free(relocs);
+    free(areas);
+    gp_coffopt_removed_insns += Insn_count;
+  }
 
+  /* update line numbers */
+  if ((Shift != 0) || (Insn_count > 0)) {
+    _removal_update_linenums(section, range);
   }
 
-  /* update symbols and line numbers for the rest of the section */
-  _removal_update(section, Shift, csaddr, inaddr);
-  return Shift;
+  return (Shift + total);
 }
 
 /* Remove the unnecessary instructions. */
@@ -1896,6 +2441,9 @@ _removal_remove_instructions (void)
   assert(_removal_list != NULL);
   assert(_removal_list->type == REMOVAL_TYPE_SECTION);
 
+  _removal_num_ranges = 0;
+  _removal_num_cuts   = 0;
+
   /* now see which instructions can be removed */
   ptr = _removal_list;
   first = NULL;
@@ -1922,6 +2470,24 @@ _removal_remove_instructions (void)
   while (ptr != _removal_list);
   /* update the last section */
   _removal_update_section(first, shift, bcnt, icnt);
+
+  /* update the symbols of all sections in one pass */
+  _removal_update_symbols();
+
+  if (_removal_ranges != NULL) {
+    free(_removal_ranges);
+  }
+
+  if (_removal_cuts != NULL) {
+    free(_removal_cuts);
+  }
+
+  _removal_ranges     = NULL;
+  _removal_num_ranges = 0;
+  _removal_max_ranges = 0;
+  _removal_cuts       = NULL;
+  _removal_num_cuts   = 0;
+  _removal_max_cuts   = 0;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -2002,9 +2568,7 @@ _pagesel_add_reloc(gp_section_t *Section, gp_reloc_t *Reloc)
     /* we need a label to track the target state */
     ptr->source = _removal_add_label (Reloc->symbol, NULL);
     /* now point to the target section */
-    while (ptr->source->type != REMOVAL_TYPE_SECTION) {
-      ptr->source = ptr->source->prev;
-    }
+    ptr->source = _removal_find_section(ptr->source);
     return true;
   }
   /* add a label for the relocation */
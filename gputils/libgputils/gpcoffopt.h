@@ -38,4 +38,6 @@ extern void gp_coffopt_remove_unnecessary_pagesel_experimental(gp_object_t *Obje
 extern void gp_coffopt_remove_unnecessary_banksel_experimental(gp_object_t *Object);
 extern void gp_coffopt_remove_unnecessary_pcallw_experimental(gp_object_t *Object);
 
+extern unsigned int gp_coffopt_removed_insns;
+
 #endif
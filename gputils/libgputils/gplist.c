@@ -36,6 +36,21 @@ static unsigned int list_serial_id = 1;
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* The lists of the objects are created on the reader threads of gplink too. */
+
+static unsigned int
+_new_serial_id(void)
+{
+  unsigned int id;
+
+  gp_thread_lock();
+  id = list_serial_id++;
+  gp_thread_unlock();
+  return id;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 void *
 gp_list_node_new(size_t Item_size)
 {
@@ -83,7 +98,7 @@ gp_list_node_append(void *List, void *Node)
   l = (gp_list_t *)List;
 
   if (l->serial_id == LIST_INVALID_ID) {
-    l->serial_id = list_serial_id++;
+    l->serial_id = _new_serial_id();
   }
 
   n = (gp_node_t *)Node;
@@ -285,7 +300,7 @@ gp_list_make_block(void *List, size_t Num_nodes, size_t Item_size)
     assert(0);
   }
 
-  id = list_serial_id++;
+  id = _new_serial_id();
   ptr_array = (gp_node_t **)GP_Malloc(Num_nodes * sizeof(gp_node_t *));
   l->num_nodes = Num_nodes;
   l->serial_id = id;
@@ -357,7 +372,7 @@ gp_list_move(void *Dst, void *Src)
         assert(0);
       }
 
-      d->serial_id = list_serial_id++;
+      d->serial_id = _new_serial_id();
       d->first     = s->first;
       d->curr      = s->first;
     }
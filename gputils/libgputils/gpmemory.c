@@ -68,7 +68,7 @@ typedef union
           unsigned is_second_word    : 1;     [13] W_SECOND_WORD
           unsigned is_const_data     : 1;     [14] W_CONST_DATA
 
-          unsigned is_byte_listed    : 1;     [15] BYTE_LISTED_MASK
+          unsigned                   : 1;     [15] Not used.
           unsigned is_byte_used      : 1;     [16] BYTE_USED_MASK
         };
 
@@ -86,23 +86,28 @@ typedef union
         };
       } MemData_t;
 
-      typedef struct MemByte {
-        MemData_t     data;           The data byte and the attributes of.
+      typedef struct MemNamePage {
+        const char   *section_name[I_MEM_PAGE_SIZE];   During assembly or linking shows the name of section.
 
-        char         *section_name;   During assembly or linking shows the name of section.
+        const char   *symbol_name[I_MEM_PAGE_SIZE];    During assembly or linking shows the name of symbol.
+                                                       After disassembly shows the name of function or label.
+      } MemNamePage_t;
 
-        char         *symbol_name;    During assembly or linking shows the name of symbol.
-	                              After disassembly shows the name of function or label.
-
-        unsigned int  dest_byte_addr; After disassembly shows the target byte-address (not org) of a branch.
-
-        MemArgList_t  args;
-      } MemByte_t;
+      typedef struct MemArgPage {
+        unsigned int  dest_byte_addr[I_MEM_PAGE_SIZE]; After disassembly shows the target byte-address (not org)
+                                                       of a branch.
+        MemArgList_t  args[I_MEM_PAGE_SIZE];
+      } MemArgPage_t;
 
       typedef struct MemBlock {
-        unsigned int       base;
-        MemByte_t         *memory;
-        struct MemBlock_t *next;
+        unsigned int         base;
+        MemData_t           *memory;        The data byte and the attributes of.
+        struct MemNamePage **name_pages;
+        struct MemArgPage  **arg_pages;
+        struct MemUsedMap   *used_map;
+        uint8_t             *listed;        The listed bytes, one bit per byte.
+        const char          *last_name;     The last stored name, saves the most searches in the pool.
+        struct MemBlock_t   *next;
       } MemBlock_t;
 
  Each MemBlock_t can hold up to 'I_MEM_MAX' (64kB currently) bytes. The 'base'
@@ -113,8 +118,61 @@ typedef union
  from when it was number of two byte instructions and it corresponded
  to 64k bytes which is the upper limit on inhx8m files.
 
+ Only the data and the attributes of the bytes are stored densely (4 bytes per
+ byte). The names, the branch destinations and the arguments are rarely needed
+ for every byte, so these are stored in 'I_MEM_PAGE_SIZE' sized pages, which
+ are allocated only when something is written to them.
+
+ The section_name and symbol_name point into a common name pool, so every
+ name is stored only once. The pool lives until the last memory is freed.
+
+ The first block may have a 'used_map', which holds the used areas of the
+ whole memory as ordered address ranges. It is built by the first call of
+ gp_mem_b_find_unused(), it is followed by gp_mem_b_put() and it is dropped
+ by the other modifications of the used bytes.
+
+ The listing of gplink marks the listed bytes in the 'listed' bit array of the
+ block, apart from the data. So the listing does not write the memory which
+ the other writers of the output read at the same time.
+
  **************************************************************************************************/
 
+#define I_MEM_PAGE_BITS         8
+#define I_MEM_PAGE_SIZE         (1 << I_MEM_PAGE_BITS)
+#define I_MEM_PAGE_MASK         (I_MEM_PAGE_SIZE - 1)
+#define I_MEM_PAGE_NUM          (I_MEM_MAX / I_MEM_PAGE_SIZE)
+
+#define IMemPageFromOffs(Offs)  ((Offs) >> I_MEM_PAGE_BITS)
+#define IMemIdxFromOffs(Offs)   ((Offs) & I_MEM_PAGE_MASK)
+
+typedef struct MemNamePage {
+  const char   *section_name[I_MEM_PAGE_SIZE];
+  const char   *symbol_name[I_MEM_PAGE_SIZE];
+} MemNamePage_t;
+
+typedef struct MemArgPage {
+  unsigned int  dest_byte_addr[I_MEM_PAGE_SIZE];
+  MemArgList_t  args[I_MEM_PAGE_SIZE];
+} MemArgPage_t;
+
+typedef struct MemUsedArea {
+  unsigned int  start;
+  unsigned int  end;                    /* Inclusive. */
+} MemUsedArea_t;
+
+typedef struct MemUsedMap {
+  MemUsedArea_t *areas;                 /* Ordered, disjoint and not adjacent areas. */
+  size_t         num_areas;
+  size_t         max_areas;
+} MemUsedMap_t;
+
+/* The names of the sections and symbols are stored only once in this pool. The pool
+   is common for all memories and will be destroyed when the last memory is freed.
+   The memories may be filled by more threads, so the pool is used under the lock. */
+
+static symbol_table_t *name_pool       = NULL;
+static unsigned int    name_pool_users = 0;
+
 /**************************************************************************************************
  * _memory_new
  *
@@ -132,8 +190,13 @@ _memory_new(MemBlock_t *M, MemBlock_t *Mbp, unsigned int Base_address)
 {
   unsigned int block = IMemBaseFromAddr(Base_address);
 
-  Mbp->base   = block;
-  Mbp->memory = (MemByte_t *)GP_Calloc(I_MEM_MAX, sizeof(MemByte_t));
+  Mbp->base       = block;
+  Mbp->memory     = (MemData_t *)GP_Calloc(I_MEM_MAX, sizeof(MemData_t));
+  Mbp->name_pages = NULL;
+  Mbp->arg_pages  = NULL;
+  Mbp->used_map   = NULL;
+  Mbp->listed     = NULL;
+  Mbp->last_name  = NULL;
 
   do {
     if ((M->next == NULL) || (M->next->base > block)) {
@@ -152,29 +215,443 @@ _memory_new(MemBlock_t *M, MemBlock_t *Mbp, unsigned int Base_address)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Finds the memory block which holds the Byte_address, if it exists already. */
+
+static MemBlock_t *
+_find_block(const MemBlock_t *M, unsigned int Byte_address)
+{
+  unsigned int block = IMemBaseFromAddr(Byte_address);
+
+  while (M != NULL) {
+    if (M->base == block) {
+      return (MemBlock_t *)M;
+    }
+
+    M = M->next;
+  }
+
+  return NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static MemNamePage_t *
+_get_name_page(const MemBlock_t *M, unsigned int Offset)
+{
+  if (M->name_pages == NULL) {
+    return NULL;
+  }
+
+  return M->name_pages[IMemPageFromOffs(Offset)];
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static MemNamePage_t *
+_make_name_page(MemBlock_t *M, unsigned int Offset)
+{
+  MemNamePage_t **page;
+
+  if (M->name_pages == NULL) {
+    M->name_pages = (MemNamePage_t **)GP_Calloc(I_MEM_PAGE_NUM, sizeof(MemNamePage_t *));
+  }
+
+  page = &M->name_pages[IMemPageFromOffs(Offset)];
+
+  if (*page == NULL) {
+    *page = (MemNamePage_t *)GP_Calloc(1, sizeof(MemNamePage_t));
+  }
+
+  return *page;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static MemArgPage_t *
+_get_arg_page(const MemBlock_t *M, unsigned int Offset)
+{
+  if (M->arg_pages == NULL) {
+    return NULL;
+  }
+
+  return M->arg_pages[IMemPageFromOffs(Offset)];
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static MemArgPage_t *
+_make_arg_page(MemBlock_t *M, unsigned int Offset)
+{
+  MemArgPage_t **page;
+
+  if (M->arg_pages == NULL) {
+    M->arg_pages = (MemArgPage_t **)GP_Calloc(I_MEM_PAGE_NUM, sizeof(MemArgPage_t *));
+  }
+
+  page = &M->arg_pages[IMemPageFromOffs(Offset)];
+
+  if (*page == NULL) {
+    *page = (MemArgPage_t *)GP_Calloc(1, sizeof(MemArgPage_t));
+  }
+
+  return *page;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static const char *
+_intern_name(MemBlock_t *M, const char *Name)
+{
+  if ((Name == NULL) || (*Name == '\0')) {
+    return NULL;
+  }
+
+  /* Mostly the same name comes again. */
+  if ((M->last_name != NULL) && (strcmp(M->last_name, Name) == 0)) {
+    return M->last_name;
+  }
+
+  gp_thread_lock();
+
+  if (name_pool == NULL) {
+    name_pool = gp_sym_push_arena_table(NULL, false);
+  }
+
+  M->last_name = gp_sym_get_symbol_name(gp_sym_add_symbol(name_pool, Name));
+  gp_thread_unlock();
+
+  return M->last_name;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static const char *
+_get_section_name(const MemBlock_t *M, unsigned int Offset)
+{
+  const MemNamePage_t *page;
+
+  page = _get_name_page(M, Offset);
+  return ((page != NULL) ? page->section_name[IMemIdxFromOffs(Offset)] : NULL);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static const char *
+_get_symbol_name(const MemBlock_t *M, unsigned int Offset)
+{
+  const MemNamePage_t *page;
+
+  page = _get_name_page(M, Offset);
+  return ((page != NULL) ? page->symbol_name[IMemIdxFromOffs(Offset)] : NULL);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 static void
-_store_section_name(MemByte_t *Mb, const char *Name)
+_store_section_name(MemBlock_t *M, unsigned int Offset, const char *Name)
 {
-  if ((Name != NULL) && (*Name != '\0')) {
-    Mb->section_name = GP_Strdup(Name);
+  Name = _intern_name(M, Name);
+
+  if (Name != NULL) {
+    _make_name_page(M, Offset)->section_name[IMemIdxFromOffs(Offset)] = Name;
   }
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
 static void
-_store_symbol_name(MemByte_t *Mb, const char *Name)
+_store_symbol_name(MemBlock_t *M, unsigned int Offset, const char *Name)
 {
-  if ((Name != NULL) && (*Name != '\0')) {
-    Mb->symbol_name = GP_Strdup(Name);
+  Name = _intern_name(M, Name);
+
+  if (Name != NULL) {
+    _make_name_page(M, Offset)->symbol_name[IMemIdxFromOffs(Offset)] = Name;
   }
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Copies all the annotations of a byte. */
+
+static void
+_copy_annotations(MemBlock_t *M, unsigned int To_offset, unsigned int From_offset)
+{
+  const MemNamePage_t *from_names;
+  MemNamePage_t       *to_names;
+  const MemArgPage_t  *from_args;
+  MemArgPage_t        *to_args;
+  unsigned int         from_idx;
+  unsigned int         to_idx;
+
+  from_idx = IMemIdxFromOffs(From_offset);
+  to_idx   = IMemIdxFromOffs(To_offset);
+
+  from_names = _get_name_page(M, From_offset);
+  if ((from_names != NULL) &&
+      ((from_names->section_name[from_idx] != NULL) || (from_names->symbol_name[from_idx] != NULL))) {
+    to_names = _make_name_page(M, To_offset);
+    to_names->section_name[to_idx] = from_names->section_name[from_idx];
+    to_names->symbol_name[to_idx]  = from_names->symbol_name[from_idx];
+  }
+  else if ((to_names = _get_name_page(M, To_offset)) != NULL) {
+    to_names->section_name[to_idx] = NULL;
+    to_names->symbol_name[to_idx]  = NULL;
+  }
+
+  from_args = _get_arg_page(M, From_offset);
+  if (from_args != NULL) {
+    to_args = _make_arg_page(M, To_offset);
+    to_args->dest_byte_addr[to_idx] = from_args->dest_byte_addr[from_idx];
+    to_args->args[to_idx]           = from_args->args[from_idx];
+  }
+  else if ((to_args = _get_arg_page(M, To_offset)) != NULL) {
+    to_args->dest_byte_addr[to_idx] = 0;
+    memset(&to_args->args[to_idx], 0, sizeof(MemArgList_t));
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Clears all the annotations of the Byte_number bytes from the Offset. */
+
+static void
+_clear_annotations(MemBlock_t *M, unsigned int Offset, unsigned int Byte_number)
+{
+  MemNamePage_t *names;
+  MemArgPage_t  *args;
+  unsigned int   idx;
+
+  if ((M->name_pages == NULL) && (M->arg_pages == NULL)) {
+    return;
+  }
+
+  for (; Byte_number > 0; ++Offset, --Byte_number) {
+    idx = IMemIdxFromOffs(Offset);
+
+    if ((names = _get_name_page(M, Offset)) != NULL) {
+      names->section_name[idx] = NULL;
+      names->symbol_name[idx]  = NULL;
+    }
+
+    if ((args = _get_arg_page(M, Offset)) != NULL) {
+      args->dest_byte_addr[idx] = 0;
+      memset(&args->args[idx], 0, sizeof(MemArgList_t));
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Moves the Byte_size bytes with all of their annotations within the block. */
+
+static void
+_move_bytes(MemBlock_t *M, unsigned int To_offset, unsigned int From_offset, unsigned int Byte_size)
+{
+  unsigned int i;
+
+  memmove(&M->memory[To_offset], &M->memory[From_offset], Byte_size * sizeof(MemData_t));
+
+  if ((M->name_pages == NULL) && (M->arg_pages == NULL)) {
+    return;
+  }
+
+  if (To_offset < From_offset) {
+    for (i = 0; i < Byte_size; ++i) {
+      _copy_annotations(M, To_offset + i, From_offset + i);
+    }
+  }
+  else {
+    for (i = Byte_size; i > 0; --i) {
+      _copy_annotations(M, To_offset + i - 1, From_offset + i - 1);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_free_pages(void **Pages)
+{
+  unsigned int i;
+
+  if (Pages == NULL) {
+    return;
+  }
+
+  for (i = 0; i < I_MEM_PAGE_NUM; ++i) {
+    if (Pages[i] != NULL) {
+      free(Pages[i]);
+    }
+  }
+
+  free(Pages);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_used_map_free(MemBlock_t *M)
+{
+  if (M->used_map != NULL) {
+    if (M->used_map->areas != NULL) {
+      free(M->used_map->areas);
+    }
+
+    free(M->used_map);
+    M->used_map = NULL;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Returns the index of the first area which ends at or after the Byte_address. */
+
+static size_t
+_used_map_search(const MemUsedMap_t *Map, unsigned int Byte_address)
+{
+  size_t low;
+  size_t high;
+  size_t mid;
+
+  low  = 0;
+  high = Map->num_areas;
+  while (low < high) {
+    mid = (low + high) >> 1;
+
+    if (Map->areas[mid].end < Byte_address) {
+      low = mid + 1;
+    }
+    else {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_used_map_insert(MemUsedMap_t *Map, size_t Index, unsigned int Start, unsigned int End)
+{
+  if (Map->num_areas >= Map->max_areas) {
+    Map->max_areas = (Map->max_areas == 0) ? 64 : (Map->max_areas * 2);
+    Map->areas     = (MemUsedArea_t *)GP_Realloc(Map->areas, Map->max_areas * sizeof(MemUsedArea_t));
+  }
+
+  if (Index < Map->num_areas) {
+    memmove(&Map->areas[Index + 1], &Map->areas[Index], (Map->num_areas - Index) * sizeof(MemUsedArea_t));
+  }
+
+  Map->areas[Index].start = Start;
+  Map->areas[Index].end   = End;
+  ++(Map->num_areas);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Adds a newly used byte to the map. */
+
+static void
+_used_map_add(MemUsedMap_t *Map, unsigned int Byte_address)
+{
+  MemUsedArea_t *area;
+  size_t         idx;
+
+  idx  = _used_map_search(Map, (Byte_address > 0) ? (Byte_address - 1) : 0);
+  area = &Map->areas[idx];
+
+  if (idx < Map->num_areas) {
+    if ((area->start <= Byte_address) && (Byte_address <= area->end)) {
+      return;
+    }
+
+    if ((Byte_address > 0) && (area->end == (Byte_address - 1))) {
+      /* Extends this area upwards, maybe until the next one. */
+      area->end = Byte_address;
+
+      if (((idx + 1) < Map->num_areas) && (area[1].start == (Byte_address + 1))) {
+        area->end = area[1].end;
+        --(Map->num_areas);
+        memmove(&area[1], &area[2], (Map->num_areas - idx - 1) * sizeof(MemUsedArea_t));
+      }
+
+      return;
+    }
+
+    if (area->start == (Byte_address + 1)) {
+      area->start = Byte_address;
+      return;
+    }
+  }
+
+  _used_map_insert(Map, idx, Byte_address, Byte_address);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static MemUsedMap_t *
+_used_map_build(MemBlock_t *M)
+{
+  MemUsedMap_t     *map;
+  const MemBlock_t *m;
+  unsigned int      address;
+  unsigned int      start;
+  unsigned int      i;
+  gp_boolean        in_area;
+
+  map = (MemUsedMap_t *)GP_Calloc(1, sizeof(MemUsedMap_t));
+
+  for (m = M; m != NULL; m = m->next) {
+    if (m->memory == NULL) {
+      continue;
+    }
+
+    address = IMemAddrFromBase(m->base);
+    start   = 0;
+    in_area = false;
+    for (i = 0; i < I_MEM_MAX; ++i) {
+      if (m->memory[i].is_byte_used) {
+        if (!in_area) {
+          start   = address + i;
+          in_area = true;
+        }
+      }
+      else if (in_area) {
+        _used_map_insert(map, map->num_areas, start, address + i - 1);
+        in_area = false;
+      }
+    }
+
+    if (in_area) {
+      _used_map_insert(map, map->num_areas, start, address + I_MEM_MAX - 1);
+    }
+  }
+
+  /* The areas of the adjacent blocks may continue each other. */
+  for (i = 1; i < map->num_areas; ) {
+    if (map->areas[i].start == (map->areas[i - 1].end + 1)) {
+      map->areas[i - 1].end = map->areas[i].end;
+      --(map->num_areas);
+      memmove(&map->areas[i], &map->areas[i + 1], (map->num_areas - i) * sizeof(MemUsedArea_t));
+    }
+    else {
+      ++i;
+    }
+  }
+
+  M->used_map = map;
+  return map;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 MemBlock_t *
 gp_mem_i_create(void)
 {
+  gp_thread_lock();
+  ++name_pool_users;
+  gp_thread_unlock();
   return (MemBlock_t *)GP_Calloc(1, sizeof(MemBlock_t));
 }
 
@@ -183,9 +660,7 @@ gp_mem_i_create(void)
 void
 gp_mem_i_free(MemBlock_t *M)
 {
-  MemBlock_t   *next;
-  MemByte_t    *b;
-  unsigned int  i;
+  MemBlock_t *next;
 
   if (M == NULL) {
     return;
@@ -193,24 +668,31 @@ gp_mem_i_free(MemBlock_t *M)
 
   do {
     if (M->memory != NULL) {
-      b = M->memory;
-      for (i = I_MEM_MAX; i; ++b, --i) {
-        if (b->section_name != NULL) {
-          free(b->section_name);
-        }
+      free(M->memory);
+    }
 
-        if (b->symbol_name != NULL) {
-          free(b->symbol_name);
-        }
-      }
+    _free_pages((void **)M->name_pages);
+    _free_pages((void **)M->arg_pages);
+    _used_map_free(M);
 
-      free(M->memory);
+    if (M->listed != NULL) {
+      free(M->listed);
     }
 
     next = M->next;
     free(M);
     M = next;
   } while (M != NULL);
+
+  gp_thread_lock();
+
+  if ((name_pool_users > 0) && (--name_pool_users == 0) && (name_pool != NULL)) {
+    /* This was the last memory, so nobody uses the names. */
+    gp_sym_pop_table(name_pool);
+    name_pool = NULL;
+  }
+
+  gp_thread_unlock();
 }
 
 /**************************************************************************************************
@@ -236,7 +718,7 @@ gp_mem_b_is_used(MemBlock_t *M, unsigned int Byte_address)
 
   do {
     if (M->base == block) {
-      return ((M->memory != NULL) && M->memory[offset].data.is_byte_used);
+      return ((M->memory != NULL) && M->memory[offset].is_byte_used);
     }
 
     M = M->next;
@@ -254,7 +736,7 @@ gp_mem_b_offset_is_used(MemBlock_t *M, unsigned int Byte_offset)
     return false;
   }
 
-  return M->memory[Byte_offset].data.is_byte_used;
+  return M->memory[Byte_offset].is_byte_used;
 }
 
 /**************************************************************************************************
@@ -280,23 +762,21 @@ gp_mem_b_get(const MemBlock_t *M, unsigned int Byte_address, uint8_t *Byte,
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
 
   while (M != NULL) {
     if (M->base == block) {
       if (M->memory != NULL) {
-        b = &M->memory[offset];
-        *Byte = b->data.byte;
+        *Byte = M->memory[offset].byte;
 
         if (Section_name != NULL) {
-          *Section_name = b->section_name;
+          *Section_name = _get_section_name(M, offset);
         }
 
         if (Symbol_name != NULL) {
-          *Symbol_name = b->symbol_name;
+          *Symbol_name = _get_symbol_name(M, offset);
         }
 
-        return b->data.is_byte_used;
+        return M->memory[offset].is_byte_used;
       }
       else {
         *Byte = 0;
@@ -352,26 +832,30 @@ gp_mem_b_put(MemBlock_t *I_memory, unsigned int Byte_address, uint8_t Value,
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
   MemBlock_t   *m = I_memory;
-  MemByte_t    *b;
+  MemData_t    *b;
 
   while (m != NULL) {
     if (m->base == block) {
       if (m->memory == NULL) {
-        m->memory = (MemByte_t *)GP_Calloc(I_MEM_MAX, sizeof(MemByte_t));
+        m->memory = (MemData_t *)GP_Calloc(I_MEM_MAX, sizeof(MemData_t));
       }
 
       b = &m->memory[offset];
 
-      if (b->section_name == NULL) {
-        _store_section_name(b, Section_name);
+      if (_get_section_name(m, offset) == NULL) {
+        _store_section_name(m, offset, Section_name);
+      }
+
+      if (_get_symbol_name(m, offset) == NULL) {
+        _store_symbol_name(m, offset, Symbol_name);
       }
 
-      if (b->symbol_name == NULL) {
-        _store_symbol_name(b, Symbol_name);
+      if ((I_memory->used_map != NULL) && (!b->is_byte_used)) {
+        _used_map_add(I_memory->used_map, Byte_address);
       }
 
-      b->data.byte         = Value;
-      b->data.is_byte_used = true;
+      b->byte         = Value;
+      b->is_byte_used = true;
       return;
     }
 
@@ -383,10 +867,15 @@ gp_mem_b_put(MemBlock_t *I_memory, unsigned int Byte_address, uint8_t Value,
 
   m = _memory_new(I_memory, (MemBlock_t *)GP_Malloc(sizeof(MemBlock_t)), Byte_address);
   b = &m->memory[offset];
-  b->data.byte         = Value;
-  b->data.is_byte_used = true;
-  _store_section_name(b, Section_name);
-  _store_symbol_name(b, Symbol_name);
+  b->byte         = Value;
+  b->is_byte_used = true;
+  _store_section_name(m, offset, Section_name);
+
+  if (I_memory->used_map != NULL) {
+    _used_map_add(I_memory->used_map, Byte_address);
+  }
+
+  _store_symbol_name(m, offset, Symbol_name);
 }
 
 /**************************************************************************************************
@@ -405,24 +894,20 @@ gp_mem_b_put(MemBlock_t *I_memory, unsigned int Byte_address, uint8_t Value,
 void
 gp_mem_b_clear(MemBlock_t *M, unsigned int Byte_address)
 {
-  unsigned int  block  = IMemBaseFromAddr(Byte_address);
-  unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
+  unsigned int   block  = IMemBaseFromAddr(Byte_address);
+  unsigned int   offset = IMemOffsFromAddr(Byte_address);
+  MemNamePage_t *names;
+
+  _used_map_free(M);
 
   while (M != NULL) {
     if (M->base == block) {
       if (M->memory != NULL) {
-        b = &M->memory[offset];
-        b->data.all = 0;
+        M->memory[offset].all = 0;
 
-        if (b->section_name != NULL) {
-          free(b->section_name);
-          b->section_name = NULL;
-        }
-
-        if (b->symbol_name != NULL) {
-          free(b->symbol_name);
-          b->symbol_name = NULL;
+        if ((names = _get_name_page(M, offset)) != NULL) {
+          names->section_name[IMemIdxFromOffs(offset)] = NULL;
+          names->symbol_name[IMemIdxFromOffs(offset)]  = NULL;
         }
       }
 
@@ -443,7 +928,7 @@ gp_mem_b_move(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byt
   unsigned int from_offset = IMemOffsFromAddr(From_byte_address);
   unsigned int to_block    = IMemBaseFromAddr(To_byte_address);
   unsigned int to_offset   = IMemOffsFromAddr(To_byte_address);
-  size_t       size;
+  unsigned int size;
 
   if ((From_byte_address == To_byte_address) || (Byte_size == 0)) {
     return;
@@ -453,10 +938,11 @@ gp_mem_b_move(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byt
   assert((from_offset + Byte_size) <= I_MEM_MAX);
   assert((to_offset + Byte_size) <= I_MEM_MAX);
 
+  _used_map_free(M);
+
   while (M != NULL) {
     if (M->base == from_block) {
-      size = Byte_size * sizeof(MemByte_t);
-      memmove(&M->memory[to_offset], &M->memory[from_offset], size);
+      _move_bytes(M, to_offset, from_offset, Byte_size);
 
       /* Clear the unused area. */
       if (from_offset > to_offset) {
@@ -478,8 +964,9 @@ gp_mem_b_move(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byt
          *   |       |XXXX|
          *   +-------+----+
          */
-        size = (from_offset - to_offset) * sizeof(MemByte_t);
-        memset(&M->memory[to_offset + Byte_size], 0, size);
+        size = from_offset - to_offset;
+        memset(&M->memory[to_offset + Byte_size], 0, size * sizeof(MemData_t));
+        _clear_annotations(M, to_offset + Byte_size, size);
       }
       else {
         /*
@@ -502,8 +989,9 @@ gp_mem_b_move(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byt
          *    |XXXX|       |
          *    +----+-------+ 
          */
-        size = (to_offset - from_offset) * sizeof(MemByte_t);
-        memset(&M->memory[from_offset], 0, size);
+        size = to_offset - from_offset;
+        memset(&M->memory[from_offset], 0, size * sizeof(MemData_t));
+        _clear_annotations(M, from_offset, size);
       }
 
       return;
@@ -518,38 +1006,7 @@ gp_mem_b_move(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byt
 void
 gp_mem_b_delete(MemBlock_t *M, unsigned int Byte_address)
 {
-  unsigned int  block  = IMemBaseFromAddr(Byte_address);
-  unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
-  size_t        size;
-
-  while (M != NULL) {
-    if (M->base == block) {
-      if (M->memory != NULL) {
-        b = &M->memory[offset];
-
-        if (b->section_name != NULL) {
-          free(b->section_name);
-        }
-
-        if (b->symbol_name != NULL) {
-          free(b->symbol_name);
-        }
-
-        size = (I_MEM_MAX - offset) * sizeof(MemByte_t);
-
-        if (size != 0) {
-	  memmove(b, &M->memory[offset + 1], size);
-	}
-
-	memset(&M->memory[I_MEM_MAX], 0, sizeof(MemByte_t));
-      }
-
-      return;
-    }
-
-    M = M->next;
-  }
+  gp_mem_b_delete_area(M, Byte_address, 1);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -559,14 +1016,14 @@ gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
   unsigned int  remnant_byte_num;
-  unsigned int  i;
 
   if (Byte_number == 0) {
     return;
   }
 
+  _used_map_free(M);
+
   while (M != NULL) {
     if (M->base == block) {
       if (M->memory != NULL) {
@@ -575,16 +1032,6 @@ gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte
 
         remnant_byte_num -= Byte_number;
 
-        for (b = &M->memory[offset], i = Byte_number; i > 0; ++b, --i) {
-          if (b->section_name != NULL) {
-            free(b->section_name);
-          }
-
-          if (b->symbol_name != NULL) {
-            free(b->symbol_name);
-          }
-        }
-
 	/*
 	 *  Before the deleting.
          *
@@ -601,7 +1048,7 @@ gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte
 	 */
         if (remnant_byte_num != 0) {
           /* Delete the designated area. */
-          memmove(&M->memory[offset], &M->memory[offset + Byte_number], remnant_byte_num * sizeof(MemByte_t));
+          _move_bytes(M, offset, offset + Byte_number, remnant_byte_num);
         }
 
 	/*
@@ -619,7 +1066,8 @@ gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte
          *                I_MEM_MAX
 	 */
 	/* Clear the empty area. */
-        memset(&M->memory[offset + remnant_byte_num], 0, Byte_number * sizeof(MemByte_t));
+        memset(&M->memory[offset + remnant_byte_num], 0, Byte_number * sizeof(MemData_t));
+        _clear_annotations(M, offset + remnant_byte_num, Byte_number);
       }
 
       return;
@@ -629,6 +1077,176 @@ gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte
   }
 }
 
+/**************************************************************************************************
+ * gp_mem_b_delete_areas
+ *
+ * Deletes several areas in one pass. The result is the same as if gp_mem_b_delete_area() had
+ * been called for each area from the last one to the first one, but the rest of a block is
+ * moved only once.
+ *
+ * Inputs:
+ *  M         - start of the memory
+ *  Areas     - the areas in increasing address order, none of them overlaps an other one
+ *              and none of them crosses the border of a block
+ *  Num_areas - number of the areas
+ *
+ **************************************************************************************************/
+
+void
+gp_mem_b_delete_areas(MemBlock_t *M, const MemArea_t *Areas, unsigned int Num_areas)
+{
+  MemBlock_t   *m;
+  unsigned int  block;
+  unsigned int  offset;
+  unsigned int  src;
+  unsigned int  end;
+  unsigned int  dst;
+  unsigned int  i;
+
+  _used_map_free(M);
+
+  i = 0;
+  while (i < Num_areas) {
+    block = IMemBaseFromAddr(Areas[i].byte_address);
+    m     = M;
+    while ((m != NULL) && (m->base != block)) {
+      m = m->next;
+    }
+
+    if ((m == NULL) || (m->memory == NULL)) {
+      /* There is nothing to delete in this block. */
+      while ((i < Num_areas) && (IMemBaseFromAddr(Areas[i].byte_address) == block)) {
+        ++i;
+      }
+      continue;
+    }
+
+    /* Closes up the kept pieces of the block, between the deleted areas. */
+    dst = IMemOffsFromAddr(Areas[i].byte_address);
+    while ((i < Num_areas) && (IMemBaseFromAddr(Areas[i].byte_address) == block)) {
+      offset = IMemOffsFromAddr(Areas[i].byte_address);
+      assert(offset >= dst);
+      assert(Areas[i].byte_number <= (I_MEM_MAX - offset));
+
+      src = offset + Areas[i].byte_number;
+      ++i;
+      end = ((i < Num_areas) && (IMemBaseFromAddr(Areas[i].byte_address) == block)) ?
+              IMemOffsFromAddr(Areas[i].byte_address) : I_MEM_MAX;
+
+      if ((end > src) && (dst != src)) {
+        _move_bytes(m, dst, src, end - src);
+      }
+
+      if (end > src) {
+        dst += end - src;
+      }
+    }
+
+    /* Clear the empty area. */
+    if (dst < I_MEM_MAX) {
+      memset(&m->memory[dst], 0, (I_MEM_MAX - dst) * sizeof(MemData_t));
+      _clear_annotations(m, dst, I_MEM_MAX - dst);
+    }
+  }
+}
+
+/**************************************************************************************************
+ * gp_mem_b_copy_area
+ *
+ * Copies the used bytes of an area of an other memory into this memory. The bytes are stored
+ * such as gp_mem_b_put() would store them one by one: the data byte and the names which are
+ * not yet set. The other attributes of the bytes are not copied.
+ *
+ * Inputs:
+ *  M                 - start of the destination memory
+ *  To_byte_address   - start of the destination area
+ *  From              - start of the source memory
+ *  From_byte_address - start of the source area
+ *  Byte_number       - size of the area
+ * Returns
+ *  The number of the copied (used) bytes.
+ *
+ **************************************************************************************************/
+
+unsigned int
+gp_mem_b_copy_area(MemBlock_t *M, unsigned int To_byte_address, const MemBlock_t *From,
+                   unsigned int From_byte_address, unsigned int Byte_number)
+{
+  const MemBlock_t *from;
+  MemBlock_t       *to;
+  const MemData_t  *src;
+  MemData_t        *dst;
+  const char       *name;
+  unsigned int      from_offset;
+  unsigned int      to_offset;
+  unsigned int      size;
+  unsigned int      num_copied;
+  unsigned int      i;
+
+  _used_map_free(M);
+
+  num_copied = 0;
+  while (Byte_number > 0) {
+    /* The piece of the area which does not cross the border of a block. */
+    from_offset = IMemOffsFromAddr(From_byte_address);
+    to_offset   = IMemOffsFromAddr(To_byte_address);
+    size        = I_MEM_MAX - ((from_offset > to_offset) ? from_offset : to_offset);
+
+    if (size > Byte_number) {
+      size = Byte_number;
+    }
+
+    from = _find_block(From, From_byte_address);
+    to   = NULL;
+
+    if ((from != NULL) && (from->memory != NULL)) {
+      for (i = 0; i < size; ++i) {
+        src = &from->memory[from_offset + i];
+
+        if (!src->is_byte_used) {
+          continue;
+        }
+
+        if (to == NULL) {
+          /* The destination block is created by the first used byte. */
+          to = _find_block(M, To_byte_address);
+
+          if (to == NULL) {
+            to = _memory_new(M, (MemBlock_t *)GP_Malloc(sizeof(MemBlock_t)), To_byte_address);
+          }
+          else if (to->memory == NULL) {
+            to->memory = (MemData_t *)GP_Calloc(I_MEM_MAX, sizeof(MemData_t));
+          }
+        }
+
+        dst = &to->memory[to_offset + i];
+        dst->byte         = src->byte;
+        dst->is_byte_used = true;
+        ++num_copied;
+
+        /* The names of both memories are in the name pool already. */
+        if (from->name_pages != NULL) {
+          if (((name = _get_section_name(from, from_offset + i)) != NULL) &&
+              (_get_section_name(to, to_offset + i) == NULL)) {
+            _make_name_page(to, to_offset + i)->section_name[IMemIdxFromOffs(to_offset + i)] = name;
+          }
+
+          if (((name = _get_symbol_name(from, from_offset + i)) != NULL) &&
+              (_get_symbol_name(to, to_offset + i) == NULL)) {
+            _make_name_page(to, to_offset + i)->symbol_name[IMemIdxFromOffs(to_offset + i)] = name;
+          }
+        }
+      }
+    }
+
+    From_byte_address += size;
+    To_byte_address   += size;
+    Byte_number       -= size;
+  }
+
+  return num_copied;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 
 unsigned int
@@ -654,7 +1272,7 @@ b_range_memory_used(const MemBlock_t *M, unsigned int From_byte_address, unsigne
   /* count used bytes */
   while ((M != NULL) && (j < To_byte_address)) {
     for (i = 0; (i < I_MEM_MAX) && (j < To_byte_address); ++i) {
-      if ((M->memory != NULL) && M->memory[i].data.is_byte_used) {
+      if ((M->memory != NULL) && M->memory[i].is_byte_used) {
         ++n_bytes;
       }
       ++j;
@@ -665,6 +1283,58 @@ b_range_memory_used(const MemBlock_t *M, unsigned int From_byte_address, unsigne
   return n_bytes;
 }
 
+/**************************************************************************************************
+ * gp_mem_b_find_unused
+ *
+ * Finds the first unused area which begins or continues in the [From_byte_address,
+ * To_byte_address] range. The time of this is logarithmic in the number of used areas.
+ *
+ * Inputs:
+ *  M                 - start of the instruction memory
+ *  From_byte_address - start of the range
+ *  To_byte_address   - end of the range (inclusive)
+ * Returns
+ *  If found, the borders of the area clipped to the range (inclusive) and true.
+ *  Otherwise false.
+ *
+ **************************************************************************************************/
+
+gp_boolean
+gp_mem_b_find_unused(MemBlock_t *M, unsigned int From_byte_address, unsigned int To_byte_address,
+                     unsigned int *Start, unsigned int *End)
+{
+  const MemUsedMap_t *map;
+  size_t              idx;
+  unsigned int        start;
+  unsigned int        end;
+
+  if (From_byte_address > To_byte_address) {
+    return false;
+  }
+
+  map = (M->used_map != NULL) ? M->used_map : _used_map_build(M);
+  idx = _used_map_search(map, From_byte_address);
+
+  if ((idx < map->num_areas) && (map->areas[idx].start <= From_byte_address)) {
+    /* The From_byte_address is used, the unused area begins after this used area. */
+    if (map->areas[idx].end >= To_byte_address) {
+      return false;
+    }
+
+    start = map->areas[idx].end + 1;
+    ++idx;
+  }
+  else {
+    start = From_byte_address;
+  }
+
+  end = (idx < map->num_areas) ? (map->areas[idx].start - 1) : UINT_MAX;
+
+  *Start = start;
+  *End   = (end < To_byte_address) ? end : To_byte_address;
+  return true;
+}
+
 /*------------------------------------------------------------------------------------------------*/
 
 unsigned int
@@ -789,7 +1459,7 @@ gp_mem_i_print(const MemBlock_t *M, pic_processor_t Processor)
         row_used = false;
 
         for (j = 0; j < (2 * WORDS_IN_ROW); j++) {
-          if (M->memory[i + j].data.all != 0) {
+          if (M->memory[i + j].all != 0) {
             row_used = true;
             break;
           }
@@ -814,7 +1484,7 @@ gp_mem_i_print(const MemBlock_t *M, pic_processor_t Processor)
             }
 
             for (j = 0; j < (2 * WORDS_IN_ROW); j++) {
-              c = M->memory[i + j].data.byte;
+              c = M->memory[i + j].byte;
               putchar(isprint(c) ? c : '.');
             }
           }
@@ -841,7 +1511,7 @@ gp_mem_i_print(const MemBlock_t *M, pic_processor_t Processor)
             }
 
             for (j = 0; j < (2 * WORDS_IN_ROW); j++) {
-              c = M->memory[i + j].data.byte;
+              c = M->memory[i + j].byte;
               putchar(isprint(c) ? c : '.');
             }
           }
@@ -872,11 +1542,11 @@ gp_mem_b_set_listed(MemBlock_t *M, unsigned int Byte_address, unsigned int N_byt
   while (N_bytes--) {
     while (M != NULL) {
       if (M->base == block) {
-        if (M->memory == NULL) {
-          M->memory = (MemByte_t *)GP_Calloc(I_MEM_MAX, sizeof(MemByte_t));
+        if (M->listed == NULL) {
+          M->listed = (uint8_t *)GP_Calloc(I_MEM_MAX / 8, sizeof(uint8_t));
         }
 
-        M->memory[offset].data.is_byte_listed = true;
+        M->listed[offset / 8] |= (uint8_t)(1 << (offset % 8));
         break;
       }
 
@@ -893,6 +1563,7 @@ unsigned int
 gp_mem_b_get_unlisted_size(const MemBlock_t *M, unsigned int Byte_address)
 {
   unsigned int block   = IMemBaseFromAddr(Byte_address);
+  unsigned int offset;
   unsigned int n_bytes = 0;
 
   if ((M != NULL) && (M->memory != NULL)) {
@@ -906,7 +1577,10 @@ gp_mem_b_get_unlisted_size(const MemBlock_t *M, unsigned int Byte_address)
         }
       }
 
-      if ((M->memory != NULL) && (!M->memory[IMemOffsFromAddr(Byte_address)].data.is_byte_listed)) {
+      offset = IMemOffsFromAddr(Byte_address);
+
+      if ((M->memory != NULL) &&
+          ((M->listed == NULL) || ((M->listed[offset / 8] & (1 << (offset % 8))) == 0))) {
         /* byte at byte_address not listed */
         ++Byte_address;
         ++n_bytes;
@@ -929,17 +1603,17 @@ gp_mem_b_set_addr_type(MemBlock_t *M, unsigned int Byte_address, unsigned int Ty
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
+  MemData_t    *b;
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
       b = &M->memory[offset];
 
-      if (b->data.is_byte_used) {
-        b->data.all |= Type & W_ADDR_T_MASK;
+      if (b->is_byte_used) {
+        b->all |= Type & W_ADDR_T_MASK;
 
 	if (Type & W_ADDR_T_BRANCH_SRC) {
-	  b->dest_byte_addr = Dest_byte_addr;
+	  _make_arg_page(M, offset)->dest_byte_addr[IMemIdxFromOffs(offset)] = Dest_byte_addr;
         }
 
         return true;
@@ -962,21 +1636,24 @@ gp_mem_b_get_addr_type(const MemBlock_t *M, unsigned int Byte_address, const cha
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
+  const MemData_t    *b;
+  const MemArgPage_t *args;
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
       b = &M->memory[offset];
 
       if (Label_name != NULL) {
-	*Label_name = (b->data.all & (W_ADDR_T_FUNC | W_ADDR_T_LABEL)) ? b->symbol_name : NULL;
+	*Label_name = (b->all & (W_ADDR_T_FUNC | W_ADDR_T_LABEL)) ? _get_symbol_name(M, offset) : NULL;
       }
 
       if (Dest_byte_addr != NULL) {
-	*Dest_byte_addr = (b->data.all & W_ADDR_T_BRANCH_SRC) ? b->dest_byte_addr : 0;
+        args            = _get_arg_page(M, offset);
+	*Dest_byte_addr = ((b->all & W_ADDR_T_BRANCH_SRC) && (args != NULL)) ?
+                            args->dest_byte_addr[IMemIdxFromOffs(offset)] : 0;
       }
 
-      return (b->data.all & W_ADDR_T_MASK);
+      return (b->all & W_ADDR_T_MASK);
     }
 
     M = M->next;
@@ -1000,14 +1677,11 @@ gp_mem_b_set_addr_name(MemBlock_t *M, unsigned int Byte_address, const char *Nam
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
-      b = &M->memory[offset];
-
-      if (b->symbol_name == NULL) {
-        _store_symbol_name(b, Name);
+      if (_get_symbol_name(M, offset) == NULL) {
+        _store_symbol_name(M, offset, Name);
       }
 
       return true;
@@ -1026,25 +1700,30 @@ gp_mem_b_set_args(MemBlock_t *M, unsigned int Byte_address, unsigned int Type, c
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
+  MemData_t    *b;
+  MemArgList_t *args;
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
       b = &M->memory[offset];
 
-      if (b->data.is_byte_used) {
-        b->data.all |= Type & W_ARG_T_MASK;
+      if (b->is_byte_used) {
+        b->all |= Type & W_ARG_T_MASK;
 
-        if (Type & W_ARG_T_FIRST) {
-          b->args.first.arg  = Args->first.arg;
-          b->args.first.val  = Args->first.val;
-          b->args.first.offs = Args->first.offs;
-        }
+        if (Type & W_ARG_T_BOTH) {
+          args = &_make_arg_page(M, offset)->args[IMemIdxFromOffs(offset)];
 
-        if (Type & W_ARG_T_SECOND) {
-          b->args.second.arg  = Args->second.arg;
-          b->args.second.val  = Args->second.val;
-          b->args.second.offs = Args->second.offs;
+          if (Type & W_ARG_T_FIRST) {
+            args->first.arg  = Args->first.arg;
+            args->first.val  = Args->first.val;
+            args->first.offs = Args->first.offs;
+          }
+
+          if (Type & W_ARG_T_SECOND) {
+            args->second.arg  = Args->second.arg;
+            args->second.val  = Args->second.val;
+            args->second.offs = Args->second.offs;
+          }
         }
 
         return true;
@@ -1066,18 +1745,22 @@ gp_mem_b_get_args(const MemBlock_t *M, unsigned int Byte_address, MemArgList_t *
 {
   unsigned int  block  = IMemBaseFromAddr(Byte_address);
   unsigned int  offset = IMemOffsFromAddr(Byte_address);
-  MemByte_t    *b;
+  const MemData_t    *b;
+  const MemArgPage_t *page;
+  const MemArgList_t *args;
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
-      b = &M->memory[offset];
+      b    = &M->memory[offset];
+      page = _get_arg_page(M, offset);
+      args = (page != NULL) ? &page->args[IMemIdxFromOffs(offset)] : NULL;
 
-      if (b->data.is_byte_used) {
+      if (b->is_byte_used) {
         if (Args != NULL) {
-          if (b->data.is_arg_first) {
-            Args->first.arg  = b->args.first.arg;
-            Args->first.val  = b->args.first.val;
-            Args->first.offs = b->args.first.offs;
+          if (b->is_arg_first && (args != NULL)) {
+            Args->first.arg  = args->first.arg;
+            Args->first.val  = args->first.val;
+            Args->first.offs = args->first.offs;
           }
           else {
             Args->first.arg  = NULL;
@@ -1085,10 +1768,10 @@ gp_mem_b_get_args(const MemBlock_t *M, unsigned int Byte_address, MemArgList_t *
             Args->first.offs = 0;
           }
 
-          if (b->data.is_arg_second) {
-            Args->second.arg  = b->args.second.arg;
-            Args->second.val  = b->args.second.val;
-            Args->second.offs = b->args.second.offs;
+          if (b->is_arg_second && (args != NULL)) {
+            Args->second.arg  = args->second.arg;
+            Args->second.val  = args->second.val;
+            Args->second.offs = args->second.offs;
           }
           else {
             Args->second.arg  = NULL;
@@ -1097,7 +1780,7 @@ gp_mem_b_get_args(const MemBlock_t *M, unsigned int Byte_address, MemArgList_t *
           }
         }
 
-        return (b->data.all & W_ARG_T_MASK);
+        return (b->all & W_ARG_T_MASK);
       }
     }
 
@@ -1124,9 +1807,13 @@ gp_mem_b_set_type(MemBlock_t *M, unsigned int Byte_address, unsigned int Type)
   unsigned int block  = IMemBaseFromAddr(Byte_address);
   unsigned int offset = IMemOffsFromAddr(Byte_address);
 
+  if (Type & BYTE_USED_MASK) {
+    _used_map_free(M);
+  }
+
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
-      M->memory[offset].data.all |= Type & W_TYPE_MASK;
+      M->memory[offset].all |= Type & W_TYPE_MASK;
       return true;
     }
 
@@ -1144,9 +1831,13 @@ gp_mem_b_clear_type(MemBlock_t *M, unsigned int Byte_address, unsigned int Type)
   unsigned int block  = IMemBaseFromAddr(Byte_address);
   unsigned int offset = IMemOffsFromAddr(Byte_address);
 
+  if (Type & BYTE_USED_MASK) {
+    _used_map_free(M);
+  }
+
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
-      M->memory[offset].data.all &= ~(Type & W_TYPE_MASK);
+      M->memory[offset].all &= ~(Type & W_TYPE_MASK);
       return true;
     }
 
@@ -1166,7 +1857,7 @@ gp_mem_b_get_type(const MemBlock_t *M, unsigned int Byte_address)
 
   while (M != NULL) {
     if ((M->base == block) && (M->memory != NULL)) {
-      return (M->memory[offset].data.all & W_TYPE_MASK);
+      return (M->memory[offset].all & W_TYPE_MASK);
     }
 
     M = M->next;
@@ -69,9 +69,8 @@ typedef struct MemArgList {
 #define W_SECOND_WORD           (1 << 13)           /* PIC16E family, second word of 32 bits instruction. (movff, ...) */
 #define W_CONST_DATA            (1 << 14)           /* Data in the code area. */
 
-#define BYTE_LISTED_MASK        (1 << 15)           /* Means already listed. */
 #define BYTE_USED_MASK          (1 << 16)           /* Means occupied in MemBlock.memory.data. */
-#define BYTE_ATTR_MASK          (BYTE_USED_MASK | BYTE_LISTED_MASK)
+#define BYTE_ATTR_MASK          BYTE_USED_MASK
 
 #define W_TYPE_MASK             ((UINT_MAX << 8) & UINT_MAX)
 
@@ -91,7 +90,7 @@ typedef union __attribute__ ((packed)) MemData {
     unsigned is_second_word    : 1;     /* [13] W_SECOND_WORD */
     unsigned is_const_data     : 1;     /* [14] W_CONST_DATA */
 
-    unsigned is_byte_listed    : 1;     /* [15] BYTE_LISTED_MASK */
+    unsigned                   : 1;     /* [15] Not used. */
     unsigned is_byte_used      : 1;     /* [16] BYTE_USED_MASK */
   };
 
@@ -109,20 +108,26 @@ typedef union __attribute__ ((packed)) MemData {
   };
 } MemData_t;
 
-typedef struct MemByte {
-  MemData_t     data;
-  char         *section_name;
-  char         *symbol_name;
-  unsigned int  dest_byte_addr;
-  MemArgList_t  args;
-} MemByte_t;
+struct MemNamePage;
+struct MemArgPage;
+struct MemUsedMap;
 
 typedef struct MemBlock {
-  unsigned int     base;
-  MemByte_t       *memory;
-  struct MemBlock *next;
+  unsigned int         base;
+  MemData_t           *memory;          /* The data and the attributes of the bytes. */
+  struct MemNamePage **name_pages;      /* The section and symbol names, allocated on demand. */
+  struct MemArgPage  **arg_pages;       /* The branch destinations and arguments, allocated on demand. */
+  struct MemUsedMap   *used_map;        /* Only in the first block: The used areas, built on demand. */
+  uint8_t             *listed;          /* Bit array of the already listed bytes, allocated on demand. */
+  const char          *last_name;       /* The last name stored into this block. */
+  struct MemBlock     *next;
 } MemBlock_t;
 
+typedef struct MemArea {
+  unsigned int byte_address;
+  unsigned int byte_number;
+} MemArea_t;
+
 extern MemBlock_t *gp_mem_i_create(void);
 extern void gp_mem_i_free(MemBlock_t *M);
 
@@ -156,9 +161,17 @@ extern void gp_mem_b_delete(MemBlock_t *M, unsigned int Byte_address);
 
 extern void gp_mem_b_delete_area(MemBlock_t *M, unsigned int Byte_address, unsigned int Byte_number);
 
+extern void gp_mem_b_delete_areas(MemBlock_t *M, const MemArea_t *Areas, unsigned int Num_areas);
+
+extern unsigned int gp_mem_b_copy_area(MemBlock_t *M, unsigned int To_byte_address, const MemBlock_t *From,
+                                       unsigned int From_byte_address, unsigned int Byte_number);
+
 extern unsigned int b_range_memory_used(const MemBlock_t *M, unsigned int From_byte_address,
                                         unsigned int To_byte_address);
 
+extern gp_boolean gp_mem_b_find_unused(MemBlock_t *M, unsigned int From_byte_address,
+                                       unsigned int To_byte_address, unsigned int *Start, unsigned int *End);
+
 extern unsigned int gp_mem_b_used(const MemBlock_t *M);
 
 struct px;
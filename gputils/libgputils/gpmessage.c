@@ -40,19 +40,125 @@ static int _real_num_messages = 0;
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Write a line of message, or append it to the message buffer of the thread. */
+
+static void
+_output(const char *Prefix, const char *Text)
+{
+  gp_message_buffer_t *buffer;
+  size_t               length;
+
+  buffer = (gp_message_buffer_t *)gp_thread_get_specific();
+
+  if (buffer == NULL) {
+    /* One printf() writes the whole line, so the lines of the threads do not mix. */
+    printf("%s: %s\n", Prefix, Text);
+    return;
+  }
+
+  length = strlen(Prefix) + strlen(Text) + 3;
+
+  if ((buffer->length + length + 1) > buffer->size) {
+    buffer->size = (buffer->size * 2) + length + 1;
+    buffer->text = (char *)GP_Realloc(buffer->text, buffer->size);
+  }
+
+  snprintf(&buffer->text[buffer->length], length + 1, "%s: %s\n", Prefix, Text);
+  buffer->length += length;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* From now on the messages of this thread go to the Buffer. */
+
+void
+gp_message_buffer_begin(gp_message_buffer_t *Buffer)
+{
+  gp_thread_set_specific(Buffer);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* The messages of this thread are written again. */
+
+void
+gp_message_buffer_end(void)
+{
+  gp_thread_set_specific(NULL);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Write the lines of a buffer and empty it. */
+
+void
+gp_message_buffer_flush(gp_message_buffer_t *Buffer)
+{
+  if (Buffer->text != NULL) {
+    fwrite(Buffer->text, 1, Buffer->length, stdout);
+    free(Buffer->text);
+  }
+
+  Buffer->text   = NULL;
+  Buffer->length = 0;
+  Buffer->size   = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Drop the lines of a buffer without writing them. */
+
+void
+gp_message_buffer_discard(gp_message_buffer_t *Buffer)
+{
+  if (Buffer->text != NULL) {
+    free(Buffer->text);
+  }
+
+  Buffer->text   = NULL;
+  Buffer->length = 0;
+  Buffer->size   = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* End the program after a fatal error. The messages which are held back by this thread are written
+   first, otherwise they would be lost. */
+
+void
+gp_message_buffer_exit(int Status)
+{
+  gp_message_buffer_t *buffer;
+
+  buffer = (gp_message_buffer_t *)gp_thread_get_specific();
+
+  if (buffer != NULL) {
+    gp_thread_lock();
+    gp_message_buffer_flush(buffer);
+    fflush(stdout);
+  }
+
+  exit(Status);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 void
 gp_error(const char* Format, ...)
 {
   va_list args;
   char    buffer[BUFSIZ];
 
+  gp_thread_lock();
   _real_num_errors++;
 
   if (gp_message_disable) {
+    gp_thread_unlock();
     return;
   }
 
   gp_num_errors++;
+  gp_thread_unlock();
 
   if (gp_quiet) {
     return;
@@ -62,7 +168,7 @@ gp_error(const char* Format, ...)
   vsnprintf(buffer, sizeof(buffer), Format, args);
   va_end(args);
 
-  printf("error: %s\n", buffer);
+  _output("error", buffer);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -73,13 +179,16 @@ gp_warning(const char* Format, ...)
   va_list args;
   char    buffer[BUFSIZ];
 
+  gp_thread_lock();
   _real_num_warnings++;
 
   if (gp_message_disable) {
+    gp_thread_unlock();
     return;
   }
 
   gp_num_warnings++;
+  gp_thread_unlock();
 
   if (gp_quiet) {
     return;
@@ -89,7 +198,7 @@ gp_warning(const char* Format, ...)
   vsnprintf(buffer, sizeof(buffer), Format, args);
   va_end(args);
 
-  printf("warning: %s\n", buffer);
+  _output("warning", buffer);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -100,13 +209,16 @@ gp_message(const char* Format, ...)
   va_list args;
   char    buffer[BUFSIZ];
 
+  gp_thread_lock();
   _real_num_messages++;
 
   if (gp_message_disable) {
+    gp_thread_unlock();
     return;
   }
 
   gp_num_messages++;
+  gp_thread_unlock();
 
   if (gp_quiet) {
     return;
@@ -116,7 +228,7 @@ gp_message(const char* Format, ...)
   vsnprintf(buffer, sizeof(buffer), Format, args);
   va_end(args);
 
-  printf("message: %s\n", buffer);
+  _output("message", buffer);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -139,7 +251,7 @@ gp_debug(const char* Format, ...)
   vsnprintf(buffer, sizeof(buffer), Format, args);
   va_end(args);
 
-  printf("debug: %s\n", buffer);
+  _output("debug", buffer);
 }
 
 /*------------------------------------------------------------------------------------------------*/
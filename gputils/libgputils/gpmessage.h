@@ -26,6 +26,13 @@ extern gp_boolean gp_quiet;
 extern gp_boolean gp_message_disable;
 extern gp_boolean gp_debug_disable;
 
+/* The lines of messages which are held back until gp_message_buffer_flush(). */
+typedef struct gp_message_buffer {
+  char   *text;
+  size_t  length;
+  size_t  size;
+} gp_message_buffer_t;
+
 extern int gp_num_errors;
 extern int gp_num_warnings;
 extern int gp_num_messages;
@@ -35,6 +42,12 @@ extern void gp_warning(const char* Format, ...);
 extern void gp_message(const char* Format, ...);
 extern void gp_debug(const char* Format, ...);
 
+extern void gp_message_buffer_begin(gp_message_buffer_t *Buffer);
+extern void gp_message_buffer_end(void);
+extern void gp_message_buffer_flush(gp_message_buffer_t *Buffer);
+extern void gp_message_buffer_discard(gp_message_buffer_t *Buffer);
+extern void gp_message_buffer_exit(int Status);
+
 extern int gp_real_num_errors(void);
 extern int gp_real_num_warnings(void);
 extern int gp_real_num_messages(void);
@@ -24,6 +24,10 @@ Boston, MA 02111-1307, USA.  */
 #include "stdhdr.h"
 #include "libgputils.h"
 
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+  #include <sys/mman.h>
+#endif
+
 typedef struct lazy_linking {
   union {
     gp_symbol_t       *symbol;
@@ -45,7 +49,7 @@ _check_getl16(const uint8_t *Address, const gp_binary_t *Data)
   }
 
   gp_error("Bad object file format.");
-  exit(0);
+  gp_message_buffer_exit(0);
   /* just to make the compiler satisfied */
   return 0;
 }
@@ -62,7 +66,7 @@ _check_getl32(const uint8_t *Address, const gp_binary_t *Data)
   }
 
   gp_error("Bad object file format.");
-  exit(0);
+  gp_message_buffer_exit(0);
   /* just to make the compiler satisfied */
   return 0;
 }
@@ -634,7 +638,7 @@ _clean_symbol_table(gp_object_t *Object)
 
   curr_symbol = Object->symbol_list.first;
   while (curr_symbol != NULL) {
-    if (curr_symbol->section_number > N_UNDEF) {
+    if ((curr_symbol->section_number > N_UNDEF) && (Object->section_ptr_array != NULL)) {
       /* Assign section pointer, section numbers start at 1 (N_SCNUM) not 0 (N_UNDEF). */
       curr_symbol->section = Object->section_ptr_array[curr_symbol->section_number - N_SCNUM];
     }
@@ -691,7 +695,8 @@ gp_identify_coff_file(const char *File_name)
 
 /*------------------------------------------------------------------------------------------------*/
 
-/* Read a binary file and store it in memory. */
+/* Read a binary file and store it in memory. Where possible the file is mapped
+   read-only instead of copied, otherwise it is read into a buffer. */
 
 gp_binary_t *
 gp_read_file(const char *File_name)
@@ -700,6 +705,9 @@ gp_read_file(const char *File_name)
   gp_binary_t *file;
   struct stat  statbuf;
   off_t        n;
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+  void        *map;
+#endif
 
   infile = fopen(File_name, "rb");
   if (infile == NULL) {
@@ -713,8 +721,22 @@ gp_read_file(const char *File_name)
   fstat(fileno(infile), &statbuf);
   file->size = statbuf.st_size;
 
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+  /* An empty file or a pipe can not be mapped, these are read below. */
+  if ((file->size > 0) && S_ISREG(statbuf.st_mode)) {
+    map = mmap(NULL, (size_t)file->size, PROT_READ, MAP_PRIVATE, fileno(infile), 0);
+    if (map != MAP_FAILED) {
+      file->file    = (uint8_t *)map;
+      file->storage = GP_BINARY_MAPPED;
+      fclose(infile);
+      return file;
+    }
+  }
+#endif
+
   /* read the object file into memory */
-  file->file = (uint8_t *)GP_Malloc(file->size);
+  file->file    = (uint8_t *)GP_Malloc(file->size);
+  file->storage = GP_BINARY_BUFFER;
   n = (off_t)fread(file->file, 1, (size_t)file->size, infile);
 
   if (n != file->size) {
@@ -728,6 +750,36 @@ gp_read_file(const char *File_name)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Release the contents of a binary file, but not the descriptor. */
+
+void
+gp_release_file(gp_binary_t *Data)
+{
+  if ((Data == NULL) || (Data->file == NULL)) {
+    return;
+  }
+
+  switch (Data->storage) {
+    case GP_BINARY_BUFFER:
+      free(Data->file);
+      break;
+
+    case GP_BINARY_MAPPED:
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+      munmap(Data->file, (size_t)Data->size);
+#endif
+      break;
+
+    case GP_BINARY_VIEW:
+      /* The owner of the contents will release them. */
+      break;
+  }
+
+  Data->file = NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 /* free a binary file. */
 
 void
@@ -737,14 +789,14 @@ gp_free_file(gp_binary_t *Data)
     return;
   }
 
-  free(Data->file);
+  gp_release_file(Data);
   free(Data);
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-gp_object_t *
-gp_convert_file(const char *File_name, const gp_binary_t *Data)
+static gp_object_t *
+_convert_file(const char *File_name, const gp_binary_t *Data, gp_boolean Symbols_only)
 {
   gp_object_t *object;
 
@@ -757,7 +809,15 @@ gp_convert_file(const char *File_name, const gp_binary_t *Data)
   }
 
   _read_symbol_table(object, Data->file, Data);
-  _read_sections(object, Data->file, Data);
+
+  if (Symbols_only) {
+    /* The symbols keep only the number of their section. */
+    object->section_list.num_nodes = 0;
+  }
+  else {
+    _read_sections(object, Data->file, Data);
+  }
+
   _clean_symbol_table(object);
 
   if (object->section_ptr_array != NULL) {
@@ -777,6 +837,25 @@ gp_convert_file(const char *File_name, const gp_binary_t *Data)
 
 /*------------------------------------------------------------------------------------------------*/
 
+gp_object_t *
+gp_convert_file(const char *File_name, const gp_binary_t *Data)
+{
+  return _convert_file(File_name, Data, false);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Read only the headers and the symbol table of an object, it has no sections. The symbols
+   of the object may not be used for linking. */
+
+gp_object_t *
+gp_convert_file_symbols(const char *File_name, const gp_binary_t *Data)
+{
+  return _convert_file(File_name, Data, true);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 gp_object_t *
 gp_read_coff(const char *File_name)
 {
@@ -32,15 +32,24 @@ typedef enum gp_coff {
   GP_COFF_UNKNOWN
 } gp_coff_t;
 
+typedef enum gp_binary_storage {
+  GP_BINARY_BUFFER,             /* the contents are in an allocated buffer */
+  GP_BINARY_MAPPED,             /* the contents are a mapping of the file */
+  GP_BINARY_VIEW                /* the contents are a part of an other binary, not owned */
+} gp_binary_storage_t;
+
 typedef struct gp_binary {
-  off_t    size;                /* size of the file in bytes */
-  uint8_t *file;                /* file contents */
+  off_t                size;    /* size of the file in bytes */
+  uint8_t             *file;    /* file contents */
+  gp_binary_storage_t  storage; /* owner of the file contents */
 } gp_binary_t;
 
 extern gp_coff_t gp_identify_coff_file(const char *File_name);
 extern gp_binary_t *gp_read_file(const char *File_name);
+extern void gp_release_file(gp_binary_t *Data);
 extern void gp_free_file(gp_binary_t *Data);
 extern gp_object_t *gp_convert_file(const char *File_name, const gp_binary_t *Data);
+extern gp_object_t *gp_convert_file_symbols(const char *File_name, const gp_binary_t *Data);
 extern gp_object_t *gp_read_coff(const char *File_name);
 
 #endif
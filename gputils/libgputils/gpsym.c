@@ -25,6 +25,11 @@ Boston, MA 02111-1307, USA.  */
 #include "libgputils.h"
 
 #define HASH_TABLE_SIZE_MIN             5
+#define HASH_INDEX_SIZE_MIN             16
+
+#define ARENA_BLOCK_SIZE                4096
+#define ARENA_ALIGN                     sizeof(uint64_t)
+#define ARENA_FREE_BLOCKS_MAX           32
 
 struct symbol {
   const char *name;
@@ -32,27 +37,162 @@ struct symbol {
   hash128_t   hash;
 };
 
+/* The symbols and the names of an arena table are allocated from bigger blocks. These
+   blocks will be released in one step when the table is popped. */
+
+typedef struct arena_block {
+  struct arena_block *next;
+  size_t              size;             /* The usable size of the data. */
+  size_t              used;
+  uint8_t             data[];
+} arena_block_t;
+
+/* The symbols are found through an open addressing (linear probing) hash index, so the
+   insertion and the search are O(1). The symbol_array keeps the order of the hashes for
+   the indexed traversal. The new symbols are appended to the end of this array and it will
+   be ordered only when somebody needs the order. */
+
 struct symbol_table {
   symbol_table_t  *prev;
-  symbol_t       **symbol_array;
+  symbol_t       **symbol_array;        /* The first num_sorted elements are ordered by hash. */
   size_t           symbol_array_size;
   size_t           num_symbol;
+  size_t           num_sorted;
+  symbol_t       **hash_index;          /* The size of this always power of 2. */
+  size_t           hash_index_size;
+  arena_block_t   *arena;               /* The blocks of an arena table. */
+  gp_boolean       is_arena;
   gp_boolean       case_insensitive;
 };
 
+/* The released blocks of the arena tables, so that a new table does not need the malloc(). */
+static arena_block_t *arena_free_blocks     = NULL;
+static size_t         arena_num_free_blocks = 0;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void *
+_arena_alloc(symbol_table_t *Table, size_t Size)
+{
+  arena_block_t *block;
+  void          *ptr;
+  size_t         size;
+
+  Size  = (Size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+  block = Table->arena;
+
+  if ((block == NULL) || ((block->size - block->used) < Size)) {
+    block = NULL;
+
+    if (Size <= ARENA_BLOCK_SIZE) {
+      gp_thread_lock();
+      if (arena_free_blocks != NULL) {
+        block             = arena_free_blocks;
+        arena_free_blocks = block->next;
+        --arena_num_free_blocks;
+      }
+      gp_thread_unlock();
+    }
+
+    if (block == NULL) {
+      size        = (Size > ARENA_BLOCK_SIZE) ? Size : ARENA_BLOCK_SIZE;
+      block       = (arena_block_t *)GP_Malloc(sizeof(arena_block_t) + size);
+      block->size = size;
+    }
+
+    block->used  = 0;
+    block->next  = Table->arena;
+    Table->arena = block;
+  }
+
+  ptr          = &block->data[block->used];
+  block->used += Size;
+  return ptr;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_arena_free(symbol_table_t *Table)
+{
+  arena_block_t *block;
+  arena_block_t *next;
+
+  gp_thread_lock();
+
+  block = Table->arena;
+  while (block != NULL) {
+    next = block->next;
+
+    if ((block->size == ARENA_BLOCK_SIZE) && (arena_num_free_blocks < ARENA_FREE_BLOCKS_MAX)) {
+      block->next       = arena_free_blocks;
+      arena_free_blocks = block;
+      ++arena_num_free_blocks;
+    }
+    else {
+      free(block);
+    }
+
+    block = next;
+  }
+
+  gp_thread_unlock();
+
+  Table->arena = NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static int
+_hash_cmp(const hash128_t *Hash0, const hash128_t *Hash1)
+{
+  if (Hash0->high.u64 != Hash1->high.u64) {
+    return ((Hash0->high.u64 < Hash1->high.u64) ? -1 : 1);
+  }
+
+  if (Hash0->low.u64 != Hash1->low.u64) {
+    return ((Hash0->low.u64 < Hash1->low.u64) ? -1 : 1);
+  }
+
+  return 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Compare function for qsort(). */
+
+static int
+_sym_hash_cmp(const void *P0, const void *P1)
+{
+  const symbol_t *sym0 = *(const symbol_t **)P0;
+  const symbol_t *sym1 = *(const symbol_t **)P1;
+
+  return _hash_cmp(&sym0->hash, &sym1->hash);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 
 static symbol_t *
-_make_symbol(const char *String, hash128_t *Hash)
+_make_symbol(symbol_table_t *Table, const char *String, hash128_t *Hash)
 {
   symbol_t *sym;
+  size_t    len;
 
   if (String == NULL) {
     return NULL;
   }
 
-  sym                = GP_Malloc(sizeof(symbol_t));
-  sym->name          = GP_Strdup(String);
+  if (Table->is_arena) {
+    /* The name is placed directly after the symbol. */
+    len       = strlen(String) + 1;
+    sym       = (symbol_t *)_arena_alloc(Table, sizeof(symbol_t) + len);
+    sym->name = (const char *)memcpy((uint8_t *)sym + sizeof(symbol_t), String, len);
+  }
+  else {
+    sym       = GP_Malloc(sizeof(symbol_t));
+    sym->name = GP_Strdup(String);
+  }
+
   sym->hash.low.u64  = Hash->low.u64;
   sym->hash.high.u64 = Hash->high.u64;
   sym->annotation    = NULL;
@@ -61,48 +201,195 @@ _make_symbol(const char *String, hash128_t *Hash)
 
 /*------------------------------------------------------------------------------------------------*/
 
-static symbol_t *
-_get_symbol_from_table(const symbol_table_t *Table, hash128_t *Hash)
+static size_t
+_index_home(const symbol_table_t *Table, const hash128_t *Hash)
 {
-  symbol_t **base;
-  symbol_t **current;
-  size_t     mid;
-  size_t     len;
+  return (size_t)(Hash->low.u64 ^ Hash->high.u64) & (Table->hash_index_size - 1);
+}
 
-  assert(!(Table == NULL));
-  assert(!(Hash == NULL));
+/*------------------------------------------------------------------------------------------------*/
 
-  if ((Table->symbol_array == NULL) || (Table->num_symbol == 0)) {
-    return NULL;
+static void
+_index_put(symbol_table_t *Table, symbol_t *Sym)
+{
+  size_t mask;
+  size_t i;
+
+  mask = Table->hash_index_size - 1;
+  i    = _index_home(Table, &Sym->hash);
+  while (Table->hash_index[i] != NULL) {
+    i = (i + 1) & mask;
   }
 
-  base = Table->symbol_array;
-  len  = Table->num_symbol;
-  do {
-    mid     = len >> 1;
-    current = &base[mid];
+  Table->hash_index[i] = Sym;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Keeps the load of the hash index under 50%. */
+
+static void
+_index_reserve(symbol_table_t *Table, size_t Num_symbol)
+{
+  symbol_t **old_index;
+  size_t     old_size;
+  size_t     size;
+  size_t     i;
 
-    if ((Hash->high.u64 == (*current)->hash.high.u64) && (Hash->low.u64 == (*current)->hash.low.u64)) {
-      /* Found the symbol. */
-      return *current;
+  if ((Num_symbol * 2) <= Table->hash_index_size) {
+    return;
+  }
+
+  size = (Table->hash_index_size == 0) ? HASH_INDEX_SIZE_MIN : Table->hash_index_size;
+  while ((Num_symbol * 2) > size) {
+    size *= 2;
+  }
+
+  old_index              = Table->hash_index;
+  old_size               = Table->hash_index_size;
+  Table->hash_index      = (symbol_t **)GP_Calloc(size, sizeof(symbol_t *));
+  Table->hash_index_size = size;
+
+  if (old_index != NULL) {
+    for (i = 0; i < old_size; ++i) {
+      if (old_index[i] != NULL) {
+        _index_put(Table, old_index[i]);
+      }
     }
 
-    if (len == 1) {
-      /* This is different int the least from the sought element. */
-      break;
+    free(old_index);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static symbol_t *
+_index_find(const symbol_table_t *Table, const hash128_t *Hash)
+{
+  symbol_t *sym;
+  size_t    mask;
+  size_t    i;
+
+  if (Table->hash_index == NULL) {
+    return NULL;
+  }
+
+  mask = Table->hash_index_size - 1;
+  i    = _index_home(Table, Hash);
+  while ((sym = Table->hash_index[i]) != NULL) {
+    if ((Hash->high.u64 == sym->hash.high.u64) && (Hash->low.u64 == sym->hash.low.u64)) {
+      return sym;
     }
-    else if ((Hash->high.u64 < (*current)->hash.high.u64) ||
-	     ((Hash->high.u64 == (*current)->hash.high.u64) && (Hash->low.u64 < (*current)->hash.low.u64))) {
-      len = mid;
+
+    i = (i + 1) & mask;
+  }
+
+  return NULL;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Removes the symbol from the hash index with the "backward shift" method, so there is no
+   need for the tombstones. */
+
+static void
+_index_remove(symbol_table_t *Table, const symbol_t *Sym)
+{
+  symbol_t *sym;
+  size_t    mask;
+  size_t    hole;
+  size_t    home;
+  size_t    i;
+
+  mask = Table->hash_index_size - 1;
+  i    = _index_home(Table, &Sym->hash);
+  while (Table->hash_index[i] != Sym) {
+    assert(!(Table->hash_index[i] == NULL));
+    i = (i + 1) & mask;
+  }
+
+  hole = i;
+  Table->hash_index[hole] = NULL;
+  i = (hole + 1) & mask;
+  while ((sym = Table->hash_index[i]) != NULL) {
+    home = _index_home(Table, &sym->hash);
+
+    /* The symbol may move into the hole if its home is not in the (hole, i] cyclic range. */
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      Table->hash_index[hole] = sym;
+      Table->hash_index[i]    = NULL;
+      hole = i;
     }
-    else {
-      len  -= mid;
-      base  = current;
+
+    i = (i + 1) & mask;
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Orders the unsorted tail of the symbol_array and merges it with the sorted head. */
+
+static void
+_sort_symbol_array(const symbol_table_t *Table)
+{
+  symbol_table_t  *table;
+  symbol_t       **base;
+  symbol_t       **tail;
+  size_t           num_tail;
+  size_t           i;
+  size_t           j;
+  size_t           k;
+
+  /* This does not change the content of the table, only the order of the symbols. */
+  table = (symbol_table_t *)Table;
+
+  if (table->num_sorted >= table->num_symbol) {
+    return;
+  }
+
+  base     = table->symbol_array;
+  num_tail = table->num_symbol - table->num_sorted;
+
+  if (num_tail > 1) {
+    qsort(&base[table->num_sorted], num_tail, sizeof(symbol_t *), _sym_hash_cmp);
+  }
+
+  if (table->num_sorted > 0) {
+    tail = (symbol_t **)GP_Malloc(num_tail * sizeof(symbol_t *));
+    memcpy(tail, &base[table->num_sorted], num_tail * sizeof(symbol_t *));
+
+    /* Merges from the end backwards, so that the head need not be moved away. */
+    i = table->num_sorted;
+    j = num_tail;
+    k = table->num_symbol;
+    while (j > 0) {
+      if ((i > 0) && (_hash_cmp(&base[i - 1]->hash, &tail[j - 1]->hash) > 0)) {
+        base[--k] = base[--i];
+      }
+      else {
+        base[--k] = tail[--j];
+      }
     }
+
+    free(tail);
   }
-  while (len > 0);
 
-  return NULL;
+  table->num_sorted = table->num_symbol;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static symbol_t *
+_get_symbol_from_table(const symbol_table_t *Table, hash128_t *Hash)
+{
+  assert(!(Table == NULL));
+  assert(!(Hash == NULL));
+
+  if (Table->num_symbol == 0) {
+    return NULL;
+  }
+
+  return _index_find(Table, Hash);
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -120,12 +407,46 @@ gp_sym_push_table(symbol_table_t *Table, gp_boolean Case_insensitive)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* The symbols of this table are released in one step by the gp_sym_pop_table(), so nobody
+   may keep a pointer to these after the pop. (The annotations are not released.) */
+
+symbol_table_t *
+gp_sym_push_arena_table(symbol_table_t *Table, gp_boolean Case_insensitive)
+{
+  symbol_table_t *new_table;
+
+  new_table = gp_sym_push_table(Table, Case_insensitive);
+  new_table->is_arena = true;
+  return new_table;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 symbol_table_t *
 gp_sym_pop_table(symbol_table_t *Table)
 {
+  symbol_table_t *prev;
+
   assert(!(Table == NULL));
 
-  return Table->prev;
+  prev = Table->prev;
+
+  if (Table->is_arena) {
+    /* Destroys the whole table. */
+    _arena_free(Table);
+
+    if (Table->symbol_array != NULL) {
+      free(Table->symbol_array);
+    }
+
+    if (Table->hash_index != NULL) {
+      free(Table->hash_index);
+    }
+
+    free(Table);
+  }
+
+  return prev;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -153,22 +474,28 @@ gp_sym_get_guest_table(symbol_table_t *Table)
 symbol_t *
 gp_sym_add_symbol(symbol_table_t *Table, const char *Name)
 {
-  symbol_t  **base;
-  symbol_t  **current;
-  symbol_t   *sym;
-  size_t      mid;
-  size_t      idx;
-  size_t      len;
-  hash128_t   hash;
+  symbol_t  *sym;
+  size_t     len;
+  hash128_t  hash;
 
   assert(!(Table == NULL));
   assert(!(Name == NULL));
   assert(Table->num_symbol <= UINT32_MAX);
 
+  gp_hash_init(&hash);
+  gp_hash_str(&hash, Name, Table->case_insensitive);
+
+  sym = _get_symbol_from_table(Table, &hash);
+  if (sym != NULL) {
+    /* Found the symbol. */
+    return sym;
+  }
+
   if (Table->symbol_array == NULL) {
     Table->symbol_array      = (symbol_t **)GP_Malloc(HASH_TABLE_SIZE_MIN * sizeof(symbol_t *));
     Table->symbol_array_size = HASH_TABLE_SIZE_MIN;
     Table->num_symbol        = 0;
+    Table->num_sorted        = 0;
   }
   else if (Table->num_symbol >= Table->symbol_array_size) {
     /* Doubles the size of the table. */
@@ -177,62 +504,20 @@ gp_sym_add_symbol(symbol_table_t *Table, const char *Name)
     Table->symbol_array_size = len;
   }
 
-  gp_hash_init(&hash);
-  gp_hash_str(&hash, Name, Table->case_insensitive);
-
-  if (Table->num_symbol == 0) {
-    /* Empty the table. */
-    sym = _make_symbol(Name, &hash);
-    Table->symbol_array[0] = sym;
-    Table->num_symbol      = 1;
-    return sym;
-  }
-
-  base = Table->symbol_array;
-  len  = Table->num_symbol;
-  do {
-    mid     = len >> 1;
-    current = &base[mid];
-
-    if ((hash.high.u64 == (*current)->hash.high.u64) && (hash.low.u64 == (*current)->hash.low.u64)) {
-      /* Found the symbol. */
-      return *current;
-    }
-
-    if (len == 1) {
-      /* This is different in the least from the sought element. */
-      base = Table->symbol_array;
-      idx  = current - base;
-
-      if ((hash.high.u64 > (*current)->hash.high.u64) ||
-          ((hash.high.u64 == (*current)->hash.high.u64) && (hash.low.u64 > (*current)->hash.low.u64))) {
-	/* The new element is greather than this. */
-        ++idx;
-      }
+  _index_reserve(Table, Table->num_symbol + 1);
 
-      len = (Table->num_symbol - idx) * sizeof(symbol_t *);
-      if (len > 0) {
-	/* The new element will not be the end of the table. */
-        memmove(&base[idx + 1], &base[idx], len);
-      }
+  sym = _make_symbol(Table, Name, &hash);
+  _index_put(Table, sym);
+  Table->symbol_array[Table->num_symbol] = sym;
+  ++(Table->num_symbol);
 
-      sym = _make_symbol(Name, &hash);
-      base[idx] = sym;
-      ++(Table->num_symbol);
-      return sym;
-    }
-    else if ((hash.high.u64 < (*current)->hash.high.u64) ||
-	     ((hash.high.u64 == (*current)->hash.high.u64) && (hash.low.u64 < (*current)->hash.low.u64))) {
-      len = mid;
-    }
-    else {
-      len  -= mid;
-      base  = current;
-    }
+  if ((Table->num_sorted == (Table->num_symbol - 1)) &&
+      ((Table->num_sorted == 0) || (_hash_cmp(&Table->symbol_array[Table->num_sorted - 1]->hash, &hash) < 0))) {
+    /* The new element is greather than the last one, so the order remains. */
+    ++(Table->num_sorted);
   }
-  while (len > 0);
 
-  return NULL;
+  return sym;
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -254,6 +539,8 @@ gp_sym_remove_symbol_with_index(symbol_table_t *Table, size_t Index)
     return false;
   }
 
+  _sort_symbol_array(Table);
+
   len  = (Table->num_symbol - Index - 1) * sizeof(symbol_t *);
   base = Table->symbol_array;
   sym  = base[Index];
@@ -263,6 +550,13 @@ gp_sym_remove_symbol_with_index(symbol_table_t *Table, size_t Index)
   }
 
   --(Table->num_symbol);
+  --(Table->num_sorted);
+  _index_remove(Table, sym);
+
+  if (Table->is_arena) {
+    /* This will be released together with the table. */
+    return true;
+  }
 
   if (sym->name != NULL) {
     free((void *)sym->name);
@@ -282,9 +576,11 @@ gp_sym_remove_symbol(symbol_table_t *Table, const char *Name)
 {
   symbol_t **base;
   symbol_t **current;
+  symbol_t  *sym;
   size_t     mid;
   size_t     len;
   hash128_t  hash;
+  int        cmp;
 
   assert(!(Table == NULL));
   assert(!(Name == NULL));
@@ -295,31 +591,33 @@ gp_sym_remove_symbol(symbol_table_t *Table, const char *Name)
 
   gp_hash_init(&hash);
   gp_hash_str(&hash, Name, Table->case_insensitive);
+
+  sym = _get_symbol_from_table(Table, &hash);
+  if (sym == NULL) {
+    return false;
+  }
+
+  /* Found the symbol, now need its place in the ordered array. */
+  _sort_symbol_array(Table);
+
   base = Table->symbol_array;
   len  = Table->num_symbol;
-  do {
+  while (len > 0) {
     mid     = len >> 1;
     current = &base[mid];
+    cmp     = _hash_cmp(&hash, &(*current)->hash);
 
-    if ((hash.high.u64 == (*current)->hash.high.u64) && (hash.low.u64 == (*current)->hash.low.u64)) {
-      /* Found the symbol. */
+    if (cmp == 0) {
       return gp_sym_remove_symbol_with_index(Table, current - Table->symbol_array);
     }
-
-    if (len == 1) {
-      /* This is different int the least from the sought element. */
-      return false;
-    }
-    else if ((hash.high.u64 < (*current)->hash.high.u64) ||
-	     ((hash.high.u64 == (*current)->hash.high.u64) && (hash.low.u64 < (*current)->hash.low.u64))) {
+    else if (cmp < 0) {
       len = mid;
     }
     else {
-      len  -= mid;
-      base  = current;
+      base  = current + 1;
+      len  -= mid + 1;
     }
   }
-  while (len > 0);
 
   return false;
 }
@@ -414,6 +712,7 @@ gp_sym_get_symbol_with_index(const symbol_table_t *Table, size_t Index)
   assert(!(Table == NULL));
   assert(!(Index >= Table->num_symbol));
 
+  _sort_symbol_array(Table);
   return Table->symbol_array[Index];
 }
 
@@ -431,6 +730,7 @@ gp_sym_clone_symbol_array(const symbol_table_t *Table, symbol_compare_t Cmp)
     return NULL;
   }
 
+  _sort_symbol_array(Table);
   size  = Table->num_symbol * sizeof(symbol_t *);
   array = (const symbol_t **)GP_Malloc(size);
   memcpy(array, Table->symbol_array, size);
@@ -464,6 +764,18 @@ gp_sym_get_symbol_name(const symbol_t *Sym)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* The symbols of a table are indexed in the order of their hashes. */
+
+const hash128_t *
+gp_sym_get_symbol_hash(const symbol_t *Sym)
+{
+  assert(!(Sym == NULL));
+
+  return &Sym->hash;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 void *
 gp_sym_get_symbol_annotation(const symbol_t *Sym)
 {
@@ -474,6 +786,16 @@ gp_sym_get_symbol_annotation(const symbol_t *Sym)
 
 /*------------------------------------------------------------------------------------------------*/
 
+/* Compare two hashes of gp_sym_get_symbol_hash() in the order of gp_sym_get_symbol_with_index(). */
+
+int
+gp_sym_compare_hash(const hash128_t *Hash0, const hash128_t *Hash1)
+{
+  return _hash_cmp(Hash0, Hash1);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
 int
 gp_sym_compare_fn(const void *P0, const void *P1)
 {
@@ -35,6 +35,7 @@ typedef int (*symbol_compare_t)(const void *, const void *);
 extern size_t gp_sym_get_symbol_count(const symbol_table_t *Table);
 
 extern symbol_table_t *gp_sym_push_table(symbol_table_t *Table, gp_boolean Case_insensitive);
+extern symbol_table_t *gp_sym_push_arena_table(symbol_table_t *Table, gp_boolean Case_insensitive);
 extern symbol_table_t *gp_sym_pop_table(symbol_table_t *Table);
 extern void gp_sym_set_guest_table(symbol_table_t *Table_host, symbol_table_t *Table_guest);
 extern symbol_table_t *gp_sym_get_guest_table(symbol_table_t *Table);
@@ -51,8 +52,10 @@ extern const symbol_t **gp_sym_clone_symbol_array(const symbol_table_t *Table, s
 extern void gp_sym_annotate_symbol(symbol_t *Sym, void *Value);
 
 extern const char *gp_sym_get_symbol_name(const symbol_t *Sym);
+extern const hash128_t *gp_sym_get_symbol_hash(const symbol_t *Sym);
 extern void *gp_sym_get_symbol_annotation(const symbol_t *Sym);
 
+extern int gp_sym_compare_hash(const hash128_t *Hash0, const hash128_t *Hash1);
 extern int gp_sym_compare_fn(const void *P0, const void *P1);
 extern int gp_sym_version_compare_fn(const void *P0, const void *P1);
 
@@ -0,0 +1,230 @@
+/* Worker threads of the tools
+
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#include "stdhdr.h"
+#include "libgputils.h"
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+  #include <pthread.h>
+  #define GP_USE_PTHREAD
+#endif
+
+/* The jobs of gp_thread_run() run on a few threads. The library itself is not thread safe, only
+   the shared state which is touched while an object is read or written is guarded by the lock:
+   the serial numbers of the lists, objects and sections, the name pool of the memories, the
+   arena block cache of the symbol tables and the messages. The lock is used only while the
+   worker threads run. */
+
+#ifdef GP_USE_PTHREAD
+
+typedef struct thread_pool {
+  gp_thread_job_t  job;
+  void            *context;
+  size_t           num_jobs;
+  size_t           next_job;
+} thread_pool_t;
+
+static pthread_mutex_t pool_lock;
+static pthread_mutex_t shared_lock;
+static pthread_key_t   specific_key;
+static pthread_once_t  lock_once = PTHREAD_ONCE_INIT;
+static gp_boolean      threads_running = false;
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_init_locks(void)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutex_init(&pool_lock, NULL);
+
+  /* The messages may be written while the other shared state is locked. */
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&shared_lock, &attr);
+  pthread_mutexattr_destroy(&attr);
+
+  pthread_key_create(&specific_key, NULL);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void *
+_worker(void *Pool)
+{
+  thread_pool_t *pool = (thread_pool_t *)Pool;
+  size_t         index;
+
+  while (true) {
+    pthread_mutex_lock(&pool_lock);
+    index = pool->next_job;
+    if (index < pool->num_jobs) {
+      ++pool->next_job;
+    }
+    pthread_mutex_unlock(&pool_lock);
+
+    if (index >= pool->num_jobs) {
+      break;
+    }
+
+    pool->job(index, pool->context);
+  }
+
+  return NULL;
+}
+
+#endif /* GP_USE_PTHREAD */
+
+/* The value of gp_thread_get_specific() while the worker threads do not run. */
+static void *main_specific = NULL;
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Are there threads on this system? Otherwise gp_thread_run() does the jobs one after another. */
+
+gp_boolean
+gp_thread_available(void)
+{
+#ifdef GP_USE_PTHREAD
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Call Job() with each index below Num_jobs, on at most Num_threads threads (the calling thread is
+   one of them). The order of the jobs is not defined, the function returns when all are done. */
+
+void
+gp_thread_run(unsigned int Num_threads, size_t Num_jobs, gp_thread_job_t Job, void *Context)
+{
+#ifdef GP_USE_PTHREAD
+  pthread_t     threads[GP_THREAD_MAX];
+  thread_pool_t pool;
+  unsigned int  num_started;
+  unsigned int  i;
+#endif
+  size_t        index;
+
+  if (Num_threads > GP_THREAD_MAX) {
+    Num_threads = GP_THREAD_MAX;
+  }
+
+  if (Num_threads > Num_jobs) {
+    Num_threads = (unsigned int)Num_jobs;
+  }
+
+#ifdef GP_USE_PTHREAD
+  if ((Num_threads > 1) && (!threads_running)) {
+    pthread_once(&lock_once, _init_locks);
+
+    pool.job      = Job;
+    pool.context  = Context;
+    pool.num_jobs = Num_jobs;
+    pool.next_job = 0;
+
+    threads_running = true;
+
+    num_started = 0;
+    for (i = 1; i < Num_threads; ++i) {
+      if (pthread_create(&threads[num_started], NULL, _worker, &pool) != 0) {
+        /* The threads already started and this one do the jobs. */
+        break;
+      }
+      ++num_started;
+    }
+
+    _worker(&pool);
+
+    for (i = 0; i < num_started; ++i) {
+      pthread_join(threads[i], NULL);
+    }
+
+    threads_running = false;
+    return;
+  }
+#endif
+
+  for (index = 0; index < Num_jobs; ++index) {
+    Job(index, Context);
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Guard the shared state of the library. */
+
+void
+gp_thread_lock(void)
+{
+#ifdef GP_USE_PTHREAD
+  if (threads_running) {
+    pthread_mutex_lock(&shared_lock);
+  }
+#endif
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void
+gp_thread_unlock(void)
+{
+#ifdef GP_USE_PTHREAD
+  if (threads_running) {
+    pthread_mutex_unlock(&shared_lock);
+  }
+#endif
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Each thread has one own pointer; the message buffers use it. A job which sets it must clear it
+   before it returns. */
+
+void
+gp_thread_set_specific(void *Value)
+{
+#ifdef GP_USE_PTHREAD
+  if (threads_running) {
+    pthread_setspecific(specific_key, Value);
+    return;
+  }
+#endif
+
+  main_specific = Value;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void *
+gp_thread_get_specific(void)
+{
+#ifdef GP_USE_PTHREAD
+  if (threads_running) {
+    return pthread_getspecific(specific_key);
+  }
+#endif
+
+  return main_specific;
+}
@@ -0,0 +1,37 @@
+/* Worker threads of the tools
+
+   Copyright (C) 2026 gputils developers
+
+This file is part of gputils.
+
+gputils is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2, or (at your option)
+any later version.
+
+gputils is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with gputils; see the file COPYING.  If not, write to
+the Free Software Foundation, 59 Temple Place - Suite 330,
+Boston, MA 02111-1307, USA.  */
+
+#ifndef __GPTHREAD_H__
+#define __GPTHREAD_H__
+
+/* The upper limit of the number of threads. */
+#define GP_THREAD_MAX                   64
+
+typedef void (*gp_thread_job_t)(size_t Index, void *Context);
+
+extern gp_boolean gp_thread_available(void);
+extern void gp_thread_run(unsigned int Num_threads, size_t Num_jobs, gp_thread_job_t Job, void *Context);
+extern void gp_thread_lock(void);
+extern void gp_thread_unlock(void);
+extern void gp_thread_set_specific(void *Value);
+extern void *gp_thread_get_specific(void);
+
+#endif
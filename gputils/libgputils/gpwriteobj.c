@@ -31,65 +31,157 @@ Boston, MA 02111-1307, USA.  */
 gp_boolean gp_dump_coff = false;
 #endif
 
-/* String table offsets are 16 bits so this coff has a limit on the maximum string table size. */
-#define MAX_STRING_TABLE      0xffff
+/* The string table grows in steps of this. */
+#define STRING_TABLE_STEP     4096
 
-static uint8_t      string_table[MAX_STRING_TABLE];
+#define STRING_INDEX_SIZE_MIN 256
 
-static uint32_t     string_offsets[MAX_STRING_TABLE + 1];
-static unsigned int string_offs_num;
-static uint32_t     last_string_size;
+/* One slot of the string index. The offset 0 marks an empty slot, because
+   the first four bytes of the string table hold its byte count. */
+typedef struct string_slot {
+  uint32_t offset;
+  uint32_t size;
+  uint32_t hash;
+} string_slot_t;
+
+typedef struct string_table {
+  uint8_t       *data;          /* The byte count and the strings. */
+  uint32_t       size;          /* Allocated size of the data. */
+  string_slot_t *index;         /* Open addressing hash index of the strings. */
+  uint32_t       index_size;    /* Always a power of 2. */
+  uint32_t       num_strings;
+} string_table_t;
+
+static string_table_t string_table;
 
 /*------------------------------------------------------------------------------------------------*/
 
 static uint32_t
-_search_string(const uint8_t* Table, const uint8_t* String, uint32_t String_size)
+_string_hash(const uint8_t *String, uint32_t String_size)
 {
-  uint32_t     offs;
-  uint32_t     size;
-  unsigned int i;
-  unsigned int e;
+  hash128_t hash;
 
-  if (string_offs_num == 0) {
-    return UINT32_MAX;
+  gp_hash_init(&hash);
+  gp_hash_mem(&hash, String, String_size);
+  return (uint32_t)(hash.low.u64 ^ hash.high.u64);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_string_index_put(string_table_t *Table, uint32_t Offset, uint32_t Size, uint32_t Hash)
+{
+  uint32_t mask;
+  uint32_t i;
+
+  mask = Table->index_size - 1;
+  i    = Hash & mask;
+  while (Table->index[i].offset != 0) {
+    i = (i + 1) & mask;
   }
 
-  if (string_offs_num == 1) {
-    if (last_string_size != String_size) {
-      return UINT32_MAX;
+  Table->index[i].offset = Offset;
+  Table->index[i].size   = Size;
+  Table->index[i].hash   = Hash;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+/* Keeps the load of the string index under 50%. */
+
+static void
+_string_index_reserve(string_table_t *Table)
+{
+  string_slot_t *old_index;
+  uint32_t       old_size;
+  uint32_t       i;
+
+  if ((Table->num_strings + 1) * 2 <= Table->index_size) {
+    return;
+  }
+
+  old_index = Table->index;
+  old_size  = Table->index_size;
+
+  Table->index_size = (old_size == 0) ? STRING_INDEX_SIZE_MIN : (old_size * 2);
+  Table->index      = (string_slot_t *)GP_Calloc(Table->index_size, sizeof(string_slot_t));
+
+  for (i = 0; i < old_size; ++i) {
+    if (old_index[i].offset != 0) {
+      _string_index_put(Table, old_index[i].offset, old_index[i].size, old_index[i].hash);
     }
+  }
 
-    offs = string_offsets[0];
-    return (memcmp(&Table[offs], String, String_size) == 0) ? offs : UINT32_MAX;
+  if (old_index != NULL) {
+    free(old_index);
   }
+}
 
-  e = string_offs_num - 1;
+/*------------------------------------------------------------------------------------------------*/
 
-  for (i = 0; i < e; ++i) {
-    offs = string_offsets[i];
-    size = string_offsets[i + 1] - offs;
-    if ((size == String_size) && (memcmp(&Table[offs], String, String_size) == 0)) {
+static uint32_t
+_search_string(const string_table_t *Table, const uint8_t* String, uint32_t String_size, uint32_t Hash)
+{
+  uint32_t mask;
+  uint32_t offs;
+  uint32_t i;
+
+  if (Table->num_strings == 0) {
+    return UINT32_MAX;
+  }
+
+  mask = Table->index_size - 1;
+  i    = Hash & mask;
+  while ((offs = Table->index[i].offset) != 0) {
+    if ((Table->index[i].hash == Hash) && (Table->index[i].size == String_size) &&
+        (memcmp(&Table->data[offs], String, String_size) == 0)) {
       return offs;
     }
+
+    i = (i + 1) & mask;
   }
 
-  if (last_string_size != String_size) {
-    return UINT32_MAX;
+  return UINT32_MAX;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+static void
+_store_string(string_table_t *Table, uint32_t Offset, const uint8_t* String, uint32_t String_size,
+              uint32_t Hash)
+{
+  uint32_t need;
+
+  need = Offset + String_size;
+  if (need > Table->size) {
+    Table->size = (need + STRING_TABLE_STEP - 1) & ~(uint32_t)(STRING_TABLE_STEP - 1);
+    Table->data = (uint8_t *)GP_Realloc(Table->data, Table->size);
   }
 
-  offs = string_offsets[i];
-  return (memcmp(&Table[offs], String, String_size) == 0) ? offs : UINT32_MAX;
+  memcpy(&Table->data[Offset], String, String_size);
+  _string_index_reserve(Table);
+  _string_index_put(Table, Offset, String_size, Hash);
+  ++Table->num_strings;
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
 static void
-_store_string(uint8_t* Table, uint32_t Offset, const uint8_t* String, uint32_t String_size)
+_init_string_table(string_table_t *Table)
 {
-  memcpy(&Table[Offset], String, String_size);
-  string_offsets[string_offs_num] = Offset;
-  ++string_offs_num;
-  last_string_size = String_size;
+  if (Table->data == NULL) {
+    Table->size = STRING_TABLE_STEP;
+    Table->data = (uint8_t *)GP_Malloc(Table->size);
+  }
+
+  if (Table->index != NULL) {
+    memset(Table->index, 0, Table->index_size * sizeof(string_slot_t));
+  }
+
+  Table->num_strings = 0;
+
+  /* initialize the string table byte count */
+  gp_putl32(Table->data, (uint32_t)sizeof(uint32_t));
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -97,29 +189,30 @@ _store_string(uint8_t* Table, uint32_t Offset, const uint8_t* String, uint32_t S
 /* Write the symbol or section name into the string table. */
 
 static unsigned int
-_add_string(const char* String, uint8_t* Table)
+_add_string(const char* String, string_table_t *Table)
 {
   uint32_t nbytes;
   uint32_t offset;
   uint32_t string_size;
+  uint32_t hash;
 
   assert(!(String == NULL));
 
   string_size = (uint32_t)(strlen(String) + 1);
-  offset      = _search_string(Table, (const uint8_t*)String, string_size);
+  hash        = _string_hash((const uint8_t*)String, string_size);
+  offset      = _search_string(Table, (const uint8_t*)String, string_size, hash);
   if (offset == UINT32_MAX) {
     /* Read the number of bytes in the string table. */
-    offset = nbytes = gp_getu32(Table);
+    offset = nbytes = gp_getu32(Table->data);
 
-    /* Check the length against the max string table size. */
     nbytes += string_size;
-    assert(!(nbytes > MAX_STRING_TABLE));
+    assert(!(nbytes < offset));
 
     /* Copy the string to the table. */
-    _store_string(Table, offset, (const uint8_t*)String, string_size);
+    _store_string(Table, offset, (const uint8_t*)String, string_size, hash);
 
     /* Write the new byte count. */
-    gp_putl32(Table, nbytes);
+    gp_putl32(Table->data, nbytes);
   }
 
   return offset;
@@ -128,7 +221,7 @@ _add_string(const char* String, uint8_t* Table)
 /*------------------------------------------------------------------------------------------------*/
 
 static void
-_add_name(const char *Name, uint8_t *Table, FILE *Fp)
+_add_name(const char *Name, string_table_t *Table, FILE *Fp)
 {
   uint32_t length;
   uint32_t offset;
@@ -222,7 +315,7 @@ _write_optional_header(const gp_object_t *Object, FILE *Fp)
 /* write the section header */
 
 static void
-_write_section_header(const gp_section_t *Section, unsigned int Org_to_byte_shift, uint8_t *Table, FILE *Fp)
+_write_section_header(const gp_section_t *Section, unsigned int Org_to_byte_shift, string_table_t *Table, FILE *Fp)
 {
   uint32_t section_address;
 
@@ -340,7 +433,7 @@ _write_linenumbers(const gp_section_t *Section, unsigned int Org_to_byte_shift,
 /* write the auxiliary symbols */
 
 static void
-_write_aux_symbols(const gp_aux_t *Aux, uint8_t *Table, gp_boolean Isnew, FILE *Fp)
+_write_aux_symbols(const gp_aux_t *Aux, string_table_t *Table, gp_boolean Isnew, FILE *Fp)
 {
   unsigned int offset;
 
@@ -429,7 +522,7 @@ _write_aux_symbols(const gp_aux_t *Aux, uint8_t *Table, gp_boolean Isnew, FILE *
 /* write the symbol table */
 
 static void
-_write_symbols(const gp_object_t *Object, uint8_t *Table, FILE *Fp)
+_write_symbols(const gp_object_t *Object, string_table_t *Table, FILE *Fp)
 {
   gp_symbol_t *symbol;
   gp_boolean   isnew;
@@ -562,15 +655,11 @@ gp_writeobj_write_coff(gp_object_t *Object, int Num_errors)
     return false;
   }
 
-  string_offs_num  = 0;
-  last_string_size = 0;
+  _init_string_table(&string_table);
 
   /* update file pointers in the coff */
   _update_pointers(Object);
 
-  /* initialize the string table byte count */
-  gp_putl32(string_table, (uint32_t)sizeof(uint32_t));
-
   /* write the data to the file */
   _write_file_header(Object, coff);
   _write_optional_header(Object, coff);
@@ -579,7 +668,7 @@ gp_writeobj_write_coff(gp_object_t *Object, int Num_errors)
   org_to_byte_shift = Object->class->org_to_byte_shift;
   section           = Object->section_list.first;
   while (section != NULL) {
-    _write_section_header(section, org_to_byte_shift, string_table, coff);
+    _write_section_header(section, org_to_byte_shift, &string_table, coff);
     section = section->next;
   }
 
@@ -612,11 +701,11 @@ gp_writeobj_write_coff(gp_object_t *Object, int Num_errors)
 
   /* write symbols */
   if (Object->num_symbols != 0) {
-    _write_symbols(Object, string_table, coff);
+    _write_symbols(Object, &string_table, coff);
   }
 
   /* write string table */
-  fwrite(string_table, 1, gp_getl32(string_table), coff);
+  fwrite(string_table.data, 1, gp_getl32(string_table.data), coff);
 
   fclose(coff);
   return true;
@@ -31,6 +31,7 @@ Boston, MA 02111-1307, USA.  */
 #include "gpbitarray.h"
 #include "gpsystem.h"
 #include "gpmessage.h"
+#include "gpthread.h"
 
 /* common files */
 #include "gpmemory.h"
@@ -0,0 +1,51 @@
+#!/bin/bash
+
+# symtab-bench.sh - measure the symbol table of gpasm with many symbols
+#
+# Copyright (c) 2026 gputils developers
+#
+# This file is part of gputils.
+#
+#  This software is provided 'as-is', without any express or implied
+#  warranty.  In no event will the authors be held liable for any damages
+#  arising from the use of this software.
+#
+#  Permission is granted to anyone to use this software for any purpose,
+#  including commercial applications, and to alter it and redistribute it
+#  freely, subject to the following restrictions:
+#
+#  1. The origin of this software must not be misrepresented; you must not
+#     claim that you wrote the original software. If you use this software
+#     in a product, an acknowledgment in the product documentation would be
+#     appreciated but is not required.
+#  2. Altered source versions must be plainly marked as such, and must not be
+#     misrepresented as being the original software.
+#  3. This notice may not be removed or altered from any source distribution.
+#
+# Generates sources with 10^5 ... 10^6 EQU and #define symbols and measures
+# the time of their assembly. Nearly the whole time is spent in the symbol
+# tables (stGlobal and stDefines), so this shows their scaling.
+#
+# Usage: symtab-bench.sh [path of gpasm] [symbol counts ...]
+
+GPASM=${1:-gpasm}
+shift
+
+COUNTS=${@:-100000 200000 500000 1000000}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+for count in ${COUNTS}; do
+  src=${WORKDIR}/symtab_${count}.asm
+
+  {
+    echo "        processor 16f877a"
+    echo "        radix dec"
+    seq 0 $((count - 1)) | awk '{ print "Sym_" $1 " equ " $1; print "#define Def_" $1 " " $1 }'
+    echo "        end"
+  } > ${src}
+
+  echo "${count} symbols:"
+  ( cd ${WORKDIR} && time ${GPASM} -q -c ${src} )
+done